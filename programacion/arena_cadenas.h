@@ -0,0 +1,111 @@
+#ifndef ARENA_CADENAS_H
+#define ARENA_CADENAS_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+
+// Almacén de cadenas por bloques: cada cadena se copia al final del bloque
+// actual y se devuelve un string_view a ella. Los bloques no se mueven ni se
+// liberan mientras la arena exista, así que las vistas siguen siendo válidas
+// aunque la arena crezca o se mueva.
+//
+// Las cadenas no se liberan una por una: `liberar` sólo cuenta los bytes que
+// quedaron sin uso (por modificaciones o bajas) para decidir cuándo conviene
+// copiar las cadenas vivas a una arena nueva.
+class ArenaCadenas {
+private:
+    static const size_t TAMANO_BLOQUE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> bloques;
+    char* cursor;
+    size_t disponibles;
+    size_t reservados;
+    size_t usados;
+    size_t libres;
+
+public:
+    ArenaCadenas() : cursor(nullptr), disponibles(0), reservados(0), usados(0), libres(0) {}
+
+
+    ArenaCadenas(ArenaCadenas&& otra) noexcept
+        : bloques(std::move(otra.bloques)), cursor(otra.cursor), disponibles(otra.disponibles),
+          reservados(otra.reservados), usados(otra.usados), libres(otra.libres) {
+        otra.limpiar();
+    }
+
+
+    ArenaCadenas& operator=(ArenaCadenas&& otra) noexcept {
+        if (this != &otra) {
+            bloques = std::move(otra.bloques);
+            cursor = otra.cursor;
+            disponibles = otra.disponibles;
+            reservados = otra.reservados;
+            usados = otra.usados;
+            libres = otra.libres;
+            otra.limpiar();
+        }
+        return *this;
+    }
+
+
+    ArenaCadenas(const ArenaCadenas&) = delete;
+    ArenaCadenas& operator=(const ArenaCadenas&) = delete;
+
+
+    void limpiar() {
+        bloques.clear();
+        cursor = nullptr;
+        disponibles = 0;
+        reservados = 0;
+        usados = 0;
+        libres = 0;
+    }
+
+
+    std::string_view guardar(std::string_view cadena) {
+        if (cadena.empty()) return std::string_view();
+
+        if (cadena.size() > disponibles) {
+            size_t tamano = cadena.size() > TAMANO_BLOQUE ? cadena.size() : TAMANO_BLOQUE;
+            bloques.emplace_back(new char[tamano]);
+            cursor = bloques.back().get();
+            disponibles = tamano;
+            reservados += tamano;
+        }
+
+        std::memcpy(cursor, cadena.data(), cadena.size());
+        std::string_view guardada(cursor, cadena.size());
+        cursor += cadena.size();
+        disponibles -= cadena.size();
+        usados += cadena.size();
+        return guardada;
+    }
+
+
+    void liberar(std::string_view cadena) {
+        libres += cadena.size();
+    }
+
+
+    // Bytes pedidos al sistema en bloques.
+    size_t bytesReservados() const {
+        return reservados;
+    }
+
+
+    // Bytes de cadenas todavía en uso.
+    size_t bytesVivos() const {
+        return usados - libres;
+    }
+
+
+    size_t bytesLibres() const {
+        return libres;
+    }
+};
+
+#endif
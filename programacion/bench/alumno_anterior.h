@@ -0,0 +1,49 @@
+#ifndef BENCH_ALUMNO_ANTERIOR_H
+#define BENCH_ALUMNO_ANTERIOR_H
+
+#include <cmath>
+#include <string>
+#include <utility>
+
+
+// Alumno como era antes de la arena de cadenas, dueño de su nombre y su
+// matrícula. Las réplicas de implementaciones anteriores lo usan para medir
+// con la misma representación que tenían.
+struct AlumnoAnterior {
+    std::string nombre;
+    std::string matricula;
+    double calificacion1;
+    double calificacion2;
+    double calificacion3;
+    double calificacionFinal;
+
+
+    AlumnoAnterior() : calificacion1(0), calificacion2(0), calificacion3(0), calificacionFinal(0) {}
+
+
+    AlumnoAnterior(std::string nom, std::string mat, double c1, double c2, double c3)
+        : nombre(std::move(nom)), matricula(std::move(mat)), calificacion1(c1), calificacion2(c2), calificacion3(c3) {
+        calcularCalificacionFinal();
+    }
+
+
+    void calcularCalificacionFinal() {
+        calificacionFinal = (calificacion1 + calificacion2 + calificacion3) / 3.0;
+        calificacionFinal = std::round(calificacionFinal * 100.0) / 100.0;
+    }
+
+
+    bool estaAprobado() const {
+        return calificacionFinal >= CALIFICACION_APROBATORIA;
+    }
+
+
+    bool validarDatos() const {
+        return !nombre.empty() && !matricula.empty() &&
+               calificacion1 >= CALIFICACION_MIN && calificacion1 <= CALIFICACION_MAX &&
+               calificacion2 >= CALIFICACION_MIN && calificacion2 <= CALIFICACION_MAX &&
+               calificacion3 >= CALIFICACION_MIN && calificacion3 <= CALIFICACION_MAX;
+    }
+};
+
+#endif
@@ -0,0 +1,100 @@
+// Bytes por alumno de nombres y matrículas: std::string por alumno (versión
+// anterior) frente a la arena de cadenas del registro, recién cargado,
+// después de renombrar a todos varias veces y después de compactar la arena.
+//
+// Uso: ./bench_arena [filas] [rondas]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+
+// Memoria dinámica de una cadena: nada si cabe en el propio objeto.
+static size_t bytesDinamicos(const string& cadena) {
+    const char* inicio = reinterpret_cast<const char*>(&cadena);
+    bool enObjeto = cadena.data() >= inicio && cadena.data() < inicio + sizeof(string);
+    return enObjeto ? 0 : cadena.capacity() + 1;
+}
+
+
+static void mostrar(const char* etapa, double bytesPorAlumno, double reservadosPorAlumno) {
+    cout << setw(26) << etapa << setw(14) << bytesPorAlumno << reservadosPorAlumno << endl;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 200000;
+    int rondas = argc > 2 ? atoi(argv[2]) : 5;
+    const string archivo = "bench_arena.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    size_t bytesAnterior = 0;
+    {
+        vector<AlumnoAnterior> alumnos;
+        alumnos.reserve(filas);
+        ifstream entrada(archivo);
+        string linea;
+        while (getline(entrada, linea)) {
+            LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+            alumnos.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula),
+                                             datos.calificacion1, datos.calificacion2, datos.calificacion3));
+        }
+        for (size_t i = 0; i < alumnos.size(); i++) {
+            bytesAnterior += sizeof(AlumnoAnterior) + bytesDinamicos(alumnos[i].nombre) +
+                             bytesDinamicos(alumnos[i].matricula);
+        }
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+    remove(archivo.c_str());
+    double cantidad = sistema.getCantidadAlumnos();
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << ", rondas de renombrado: " << rondas << endl;
+    cout << "bytes por alumno (estructura + cadenas)" << endl;
+    cout << left << setw(26) << "etapa" << setw(14) << "en uso" << "reservados" << endl;
+    cout << fixed << setprecision(1);
+    mostrar("std::string (anterior)", bytesAnterior / cantidad, bytesAnterior / cantidad);
+    mostrar("arena, carga",
+            sizeof(Alumno) + sistema.bytesCadenasVivos() / cantidad,
+            sizeof(Alumno) + sistema.bytesCadenasReservados() / cantidad);
+
+    // Cada ronda cambia el nombre de todos los alumnos, como lo haría una
+    // modificación desde el menú.
+    Cronometro cronometro;
+    char matricula[24];
+    for (int r = 0; r < rondas; r++) {
+        for (long i = 1; i <= filas; i++) {
+            snprintf(matricula, sizeof(matricula), "A%07ld", i);
+            CambioBitacora cambio;
+            cambio.tipo = TipoCambio::MODIFICACION;
+            cambio.secuencia = sistema.getSecuencia() + 1;
+            cambio.matricula = matricula;
+            cambio.nuevaMatricula = matricula;
+            cambio.nombre = "Alumno renombrado " + to_string(r) + "-" + to_string(i);
+            cambio.calificacion1 = 80;
+            cambio.calificacion2 = 85;
+            cambio.calificacion3 = 90;
+            sistema.aplicarCambio(cambio);
+        }
+    }
+    double tiempo = cronometro.segundos();
+
+    mostrar("arena, tras renombrar",
+            sizeof(Alumno) + sistema.bytesCadenasVivos() / cantidad,
+            sizeof(Alumno) + sistema.bytesCadenasReservados() / cantidad);
+    sistema.compactarCadenas();
+    mostrar("arena, compactada",
+            sizeof(Alumno) + sistema.bytesCadenasVivos() / cantidad,
+            sizeof(Alumno) + sistema.bytesCadenasReservados() / cantidad);
+    cout << setprecision(3) << "renombrado (s): " << tiempo << endl;
+    return 0;
+}
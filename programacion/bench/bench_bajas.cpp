@@ -0,0 +1,116 @@
+// Tiempo de una baja masiva (fin de semestre) con el desplazamiento de
+// elementos anterior frente a las bajas con lápida e intercambio.
+//
+// Uso: ./bench_bajas [alumnos] [bajas] [--max-anterior N]
+//   --max-anterior N  tamaño máximo para el que se mide la versión anterior
+//                     (es O(N) por baja; por omisión 100000).
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+
+// Réplica de la baja anterior: búsqueda de la posición y desplazamiento de
+// todos los alumnos siguientes con asignación por copia.
+static void bajasPorDesplazamiento(vector<AlumnoAnterior>& alumnos, const vector<string>& matriculas) {
+    int cantidad = static_cast<int>(alumnos.size());
+    for (const string& matricula : matriculas) {
+        int posicion = -1;
+        for (int i = 0; i < cantidad; i++) {
+            if (alumnos[i].matricula == matricula) {
+                posicion = i;
+                break;
+            }
+        }
+        if (posicion == -1) continue;
+        for (int i = posicion; i < cantidad - 1; i++) {
+            alumnos[i] = alumnos[i + 1];
+        }
+        cantidad--;
+    }
+    alumnos.resize(cantidad);
+}
+
+
+int main(int argc, char* argv[]) {
+    vector<long> posicionales;
+    long maxAnterior = 100000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max-anterior") == 0 && i + 1 < argc) {
+            maxAnterior = atol(argv[++i]);
+        } else {
+            posicionales.push_back(atol(argv[i]));
+        }
+    }
+    long filas = posicionales.size() > 0 ? posicionales[0] : 100000;
+    long bajas = posicionales.size() > 1 ? posicionales[1] : 10000;
+    bajas = min(bajas, filas);
+    const string archivo = "bench_bajas.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    // Matrículas generadas: A0000001 .. A<filas>; se eligen `bajas` al azar.
+    vector<long> numeros(filas);
+    for (long i = 0; i < filas; i++) numeros[i] = i + 1;
+    mt19937 generador(7);
+    shuffle(numeros.begin(), numeros.end(), generador);
+    vector<string> matriculas;
+    char bufer[16];
+    for (long i = 0; i < bajas; i++) {
+        snprintf(bufer, sizeof(bufer), "A%07ld", numeros[i]);
+        matriculas.push_back(bufer);
+    }
+
+    cout << "alumnos: " << filas << ", bajas: " << bajas << endl;
+    cout << left << setw(16) << "modo" << setw(14) << "tiempo (s)" << "restantes" << endl;
+    cout << fixed << setprecision(4);
+
+    bool correcto = true;
+    const ModoBaja modos[] = {ModoBaja::LAPIDA, ModoBaja::INTERCAMBIO};
+    const char* nombres[] = {"lapida", "intercambio"};
+    for (int m = 0; m < 2; m++) {
+        SistemaAdministrativo sistema;
+        sistema.asignarModoBaja(modos[m]);
+        sistema.cargarDesdeArchivo(archivo);
+
+        Cronometro cronometro;
+        for (const string& matricula : matriculas) {
+            correcto = sistema.eliminarPorMatricula(matricula) && correcto;
+        }
+        double tiempo = cronometro.segundos();
+        correcto = correcto && sistema.getCantidadAlumnos() == filas - bajas;
+        cout << setw(16) << nombres[m] << setw(14) << tiempo << sistema.getCantidadAlumnos() << endl;
+    }
+
+    if (filas <= maxAnterior) {
+        vector<AlumnoAnterior> alumnos;
+        ifstream entrada(archivo);
+        string linea;
+        while (getline(entrada, linea)) {
+            LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+            alumnos.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula),
+                                             datos.calificacion1, datos.calificacion2, datos.calificacion3));
+        }
+
+        Cronometro cronometro;
+        bajasPorDesplazamiento(alumnos, matriculas);
+        cout << setw(16) << "desplazamiento" << setw(14) << cronometro.segundos() << alumnos.size() << endl;
+    } else {
+        cout << setw(16) << "desplazamiento" << setw(14) << "omitido" << "-" << endl;
+    }
+
+    remove(archivo.c_str());
+    if (!correcto) {
+        cerr << "Error: no se eliminaron todos los alumnos esperados." << endl;
+        return 1;
+    }
+    return 0;
+}
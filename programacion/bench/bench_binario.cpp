@@ -0,0 +1,72 @@
+// Tiempos de carga y guardado del formato de texto (alumnos.txt) frente a la
+// instantánea binaria (alumnos.bin).
+//
+// Uso: ./bench_binario [filas] [repeticiones]
+
+#include "../sistema_core.h"
+#include "comun.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+
+static double megabytesDe(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo, ios::binary | ios::ate);
+    return archivo.is_open() ? archivo.tellg() / (1024.0 * 1024.0) : 0.0;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 3;
+    const string origen = "bench_binario_origen.tmp";
+    const string texto = "bench_binario.txt.tmp";
+    const string binario = "bench_binario.bin.tmp";
+
+    if (!generarArchivoAlumnos(origen, filas)) {
+        cerr << "Error: No se pudo generar " << origen << endl;
+        return 1;
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(origen);
+
+    double guardarTexto = 1e30, cargarTexto = 1e30, guardarBin = 1e30, cargarBin = 1e30;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        sistema.guardarEnArchivo(texto);
+        guardarTexto = min(guardarTexto, cronometro.segundos());
+
+        cronometro.reiniciar();
+        sistema.guardarBinario(binario);
+        guardarBin = min(guardarBin, cronometro.segundos());
+
+        cronometro.reiniciar();
+        SistemaAdministrativo desdeTexto;
+        desdeTexto.cargarDesdeArchivo(texto);
+        cargarTexto = min(cargarTexto, cronometro.segundos());
+
+        cronometro.reiniciar();
+        SistemaAdministrativo desdeBinario;
+        desdeBinario.cargarBinario(binario);
+        cargarBin = min(cargarBin, cronometro.segundos());
+
+        if (desdeBinario.getCantidadAlumnos() != sistema.getCantidadAlumnos()) {
+            cerr << "Error: la instantánea no conserva todos los alumnos." << endl;
+            return 1;
+        }
+    }
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << endl;
+    cout << left << setw(10) << "formato" << setw(12) << "MB" << setw(14) << "guardar (s)" << "cargar (s)" << endl;
+    cout << fixed << setw(10) << "texto" << setw(12) << setprecision(1) << megabytesDe(texto)
+         << setw(14) << setprecision(4) << guardarTexto << cargarTexto << endl;
+    cout << setw(10) << "binario" << setw(12) << setprecision(1) << megabytesDe(binario)
+         << setw(14) << setprecision(4) << guardarBin << cargarBin << endl;
+
+    remove(origen.c_str());
+    remove(texto.c_str());
+    remove(binario.c_str());
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Mide el rendimiento (MB/s) de cargarDesdeArchivo, que proyecta el archivo
+// en memoria y lo analiza con string_view/from_chars, frente a una lectura
+// con getline + substr + stod. Con hilos > 1 mide también la carga por
+// bloques en paralelo (--threads).
+//
+// Uso: ./bench_carga [filas] [repeticiones] [hilos]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <unordered_set>
+
+using namespace std;
+
+
+static int cargarConGetline(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo);
+    if (!archivo.is_open()) return -1;
+
+    unordered_set<string> matriculas;
+    int cargados = 0;
+    string linea;
+    while (getline(archivo, linea)) {
+        linea.erase(0, linea.find_first_not_of(" \t\n\r"));
+        linea.erase(linea.find_last_not_of(" \t\n\r") + 1);
+        if (linea.empty()) continue;
+
+        size_t pos1 = linea.find('|');
+        size_t pos2 = linea.find('|', pos1 + 1);
+        size_t pos3 = linea.find('|', pos2 + 1);
+        size_t pos4 = linea.find('|', pos3 + 1);
+        if (pos4 == string::npos) continue;
+
+        string nombre = linea.substr(0, pos1);
+        string matricula = linea.substr(pos1 + 1, pos2 - pos1 - 1);
+        double cal1 = stod(linea.substr(pos2 + 1, pos3 - pos2 - 1));
+        double cal2 = stod(linea.substr(pos3 + 1, pos4 - pos3 - 1));
+        double cal3 = stod(linea.substr(pos4 + 1));
+        if (!matriculas.insert(matricula).second) continue;
+
+        AlumnoAnterior alumno(nombre, matricula, cal1, cal2, cal3);
+        cargados += alumno.validarDatos() ? 1 : 0;
+    }
+    return cargados;
+}
+
+
+static long tamanoArchivo(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo, ios::binary | ios::ate);
+    return archivo.is_open() ? static_cast<long>(archivo.tellg()) : 0;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 3;
+    int hilos = argc > 3 ? atoi(argv[3]) : static_cast<int>(thread::hardware_concurrency());
+    const string archivo = "bench_carga.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+    double megabytes = tamanoArchivo(archivo) / (1024.0 * 1024.0);
+
+    double mejorMapeado = 1e30, mejorGetline = 1e30, mejorParalelo = 1e30;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        SistemaAdministrativo sistema;
+        sistema.cargarDesdeArchivo(archivo);
+        mejorMapeado = min(mejorMapeado, cronometro.segundos());
+
+        if (hilos > 1) {
+            cronometro.reiniciar();
+            SistemaAdministrativo paralelo;
+            paralelo.cargarDesdeArchivo(archivo, hilos);
+            mejorParalelo = min(mejorParalelo, cronometro.segundos());
+        }
+
+        cronometro.reiniciar();
+        cargarConGetline(archivo);
+        mejorGetline = min(mejorGetline, cronometro.segundos());
+    }
+
+    cout << "archivo: " << filas << " filas, " << fixed << setprecision(1) << megabytes << " MB" << endl;
+    cout << left << setw(12) << "cargador" << setw(14) << "tiempo (s)" << "MB/s" << endl;
+    cout << setw(12) << "mmap" << setw(14) << setprecision(4) << mejorMapeado
+         << setprecision(1) << megabytes / mejorMapeado << endl;
+    if (hilos > 1) {
+        cout << setw(12) << ("mmap x" + to_string(hilos)) << setw(14) << setprecision(4) << mejorParalelo
+             << setprecision(1) << megabytes / mejorParalelo << endl;
+    }
+    cout << setw(12) << "getline" << setw(14) << setprecision(4) << mejorGetline
+         << setprecision(1) << megabytes / mejorGetline << endl;
+
+    remove(archivo.c_str());
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Consultas por matrícula desde varios hilos mientras un hilo escritor
+// modifica calificaciones: sistema protegido con un candado de lectores y
+// escritor (shared_mutex) frente a SistemaConcurrente (doble instancia,
+// los lectores no esperan). Cada lectura comprueba que la calificación
+// final corresponda a sus parciales, para detectar lecturas a medias.
+//
+// Uso: ./bench_concurrencia [alumnos] [segundos por prueba]
+
+#include "../sistema_core.h"
+#include "comun.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+
+using namespace std;
+
+
+struct Medicion {
+    double lecturasPorSegundo;
+    double escriturasPorSegundo;
+    long inconsistentes;
+};
+
+
+static bool fichaConsistente(const FichaAlumno& ficha) {
+    Alumno calculado(ficha.nombre, ficha.matricula, ficha.calificacion1, ficha.calificacion2,
+                     ficha.calificacion3);
+    return calculado.calificacionFinal == ficha.calificacionFinal;
+}
+
+
+// Ejecuta `hilos` lectores y un escritor durante `segundos`. `leer` y
+// `escribir` reciben la matrícula y el generador del hilo.
+template <typename Lectura, typename Escritura>
+static Medicion medir(int hilos, double segundos, long alumnos, Lectura leer, Escritura escribir) {
+    atomic<bool> detener(false);
+    atomic<long> lecturas(0), escrituras(0), inconsistentes(0);
+
+    auto matriculaAlAzar = [alumnos](mt19937& generador, char* matricula) {
+        snprintf(matricula, 24, "A%07ld", static_cast<long>(generador() % alumnos) + 1);
+    };
+
+    vector<thread> lectores;
+    for (int h = 0; h < hilos; h++) {
+        lectores.emplace_back([&, h] {
+            mt19937 generador(h + 1);
+            char matricula[24];
+            long propias = 0, malas = 0;
+            while (!detener.load(memory_order_relaxed)) {
+                matriculaAlAzar(generador, matricula);
+                FichaAlumno ficha;
+                if (leer(matricula, ficha) && !fichaConsistente(ficha)) malas++;
+                propias++;
+            }
+            lecturas += propias;
+            inconsistentes += malas;
+        });
+    }
+
+    thread escritor([&] {
+        mt19937 generador(12345);
+        char matricula[24];
+        long propias = 0;
+        while (!detener.load(memory_order_relaxed)) {
+            matriculaAlAzar(generador, matricula);
+            if (escribir(matricula, generador)) propias++;
+        }
+        escrituras += propias;
+    });
+
+    Cronometro cronometro;
+    this_thread::sleep_for(chrono::duration<double>(segundos));
+    detener = true;
+    for (thread& lector : lectores) {
+        lector.join();
+    }
+    escritor.join();
+    double transcurrido = cronometro.segundos();
+
+    return Medicion{lecturas / transcurrido, escrituras / transcurrido, inconsistentes.load()};
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 200000;
+    double segundos = argc > 2 ? atof(argv[2]) : 1.0;
+    const string archivo = "bench_concurrencia.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+    SistemaAdministrativo conCandado;
+    conCandado.cargarDesdeArchivo(archivo);
+    remove(archivo.c_str());
+    SistemaConcurrente concurrente{SistemaAdministrativo(conCandado)};
+    shared_mutex candado;
+
+    // El escritor cambia el primer parcial del alumno y con ello su final.
+    auto nuevaVersion = [](const FichaAlumno& ficha, mt19937& generador) {
+        return Alumno(ficha.nombre, ficha.matricula, (generador() % 1001) / 10.0, ficha.calificacion2,
+                      ficha.calificacion3);
+    };
+
+    auto leerConCandado = [&](const char* matricula, FichaAlumno& ficha) {
+        shared_lock<shared_mutex> bloqueo(candado);
+        return conCandado.buscar(matricula, ficha);
+    };
+    auto escribirConCandado = [&](const char* matricula, mt19937& generador) {
+        unique_lock<shared_mutex> bloqueo(candado);
+        FichaAlumno ficha;
+        if (!conCandado.buscar(matricula, ficha)) return false;
+        return conCandado.actualizar(matricula, nuevaVersion(ficha, generador));
+    };
+    auto leerConcurrente = [&](const char* matricula, FichaAlumno& ficha) {
+        return concurrente.buscar(matricula, ficha);
+    };
+    auto escribirConcurrente = [&](const char* matricula, mt19937& generador) {
+        FichaAlumno ficha;
+        if (!concurrente.buscar(matricula, ficha)) return false;
+        return concurrente.actualizar(matricula, nuevaVersion(ficha, generador));
+    };
+
+    cout << "alumnos: " << filas << ", nucleos: " << thread::hardware_concurrency()
+         << ", " << segundos << " s por prueba" << endl;
+    cout << left << setw(8) << "hilos" << setw(22) << "metodo" << setw(18) << "lecturas/s"
+         << setw(16) << "escrituras/s" << "inconsistentes" << endl;
+    cout << fixed << setprecision(0);
+
+    long inconsistentes = 0;
+    for (int hilos : {1, 4, 16, 64}) {
+        Medicion candadoRW = medir(hilos, segundos, filas, leerConCandado, escribirConCandado);
+        Medicion dobleInstancia = medir(hilos, segundos, filas, leerConcurrente, escribirConcurrente);
+        inconsistentes += candadoRW.inconsistentes + dobleInstancia.inconsistentes;
+
+        cout << setw(8) << hilos << setw(22) << "shared_mutex" << setw(18) << candadoRW.lecturasPorSegundo
+             << setw(16) << candadoRW.escriturasPorSegundo << candadoRW.inconsistentes << endl;
+        cout << setw(8) << hilos << setw(22) << "doble instancia" << setw(18) << dobleInstancia.lecturasPorSegundo
+             << setw(16) << dobleInstancia.escriturasPorSegundo << dobleInstancia.inconsistentes << endl;
+    }
+
+    cout << (inconsistentes == 0 ? "lecturas consistentes" : "HAY LECTURAS INCONSISTENTES") << endl;
+    return inconsistentes == 0 ? 0 : 1;
+}
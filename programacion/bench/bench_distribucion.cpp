@@ -0,0 +1,140 @@
+// Percentiles e histograma de las calificaciones finales: copia y
+// ordenamiento de la columna frente al conteo por centésima en una pasada,
+// frente a la consulta de la distribución mantenida (recién consultada y
+// tras un cambio en el registro).
+//
+// Uso: ./bench_distribucion [alumnos] [repeticiones]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+
+static const double PERCENTILES[] = {10, 25, 50, 75, 90};
+static const int INTERVALOS = 10;
+
+
+struct ResultadoDistribucion {
+    vector<double> percentiles;
+    vector<size_t> histograma;
+
+    bool operator==(const ResultadoDistribucion& otro) const {
+        return percentiles == otro.percentiles && histograma == otro.histograma;
+    }
+};
+
+
+// Con ordenamiento: copia la columna en centésimas, la ordena e interpola
+// igual que DistribucionCalificaciones::percentil.
+static ResultadoDistribucion porOrdenamiento(const double* finales, size_t n) {
+    vector<int> valores(n);
+    for (size_t i = 0; i < n; i++) {
+        valores[i] = aCentesimas(finales[i]);
+    }
+    sort(valores.begin(), valores.end());
+
+    ResultadoDistribucion resultado;
+    for (double p : PERCENTILES) {
+        double rango = (n - 1) * p / 100.0;
+        size_t inferior = static_cast<size_t>(rango);
+        double fraccion = rango - inferior;
+        double valor = valores[inferior];
+        if (fraccion > 0.0) valor += fraccion * (valores[inferior + 1] - valor);
+        resultado.percentiles.push_back(valor / 100.0);
+    }
+    for (int i = 0; i < INTERVALOS; i++) {
+        int desde = DistribucionCalificaciones::limiteIntervalo(i, INTERVALOS);
+        int hasta = i + 1 == INTERVALOS ? 10001 : DistribucionCalificaciones::limiteIntervalo(i + 1, INTERVALOS);
+        resultado.histograma.push_back(static_cast<size_t>(
+            lower_bound(valores.begin(), valores.end(), hasta) - lower_bound(valores.begin(), valores.end(), desde)));
+    }
+    return resultado;
+}
+
+
+static ResultadoDistribucion consultar(const DistribucionCalificaciones& distribucion) {
+    ResultadoDistribucion resultado;
+    for (double p : PERCENTILES) {
+        resultado.percentiles.push_back(distribucion.percentil(p));
+    }
+    resultado.histograma = distribucion.histograma(INTERVALOS);
+    return resultado;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 5;
+    const string archivo = "bench_distribucion.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+
+    // Copia de la columna de finales; el archivo generado no tiene líneas
+    // inválidas ni duplicadas, así que queda en el orden del registro.
+    vector<double> finales;
+    finales.reserve(filas);
+    ifstream entrada(archivo);
+    string linea;
+    while (getline(entrada, linea)) {
+        LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+        finales.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula), datos.calificacion1,
+                                         datos.calificacion2, datos.calificacion3).calificacionFinal);
+    }
+    remove(archivo.c_str());
+
+    double tOrdenamiento = 1e30, tConteo = 1e30, tMantenida = 1e30, tTrasCambio = 1e30;
+    ResultadoDistribucion ordenado, contado, mantenido, trasCambio;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        ordenado = porOrdenamiento(finales.data(), finales.size());
+        tOrdenamiento = min(tOrdenamiento, cronometro.segundos());
+
+        cronometro.reiniciar();
+        DistribucionCalificaciones distribucion;
+        distribucion.reconstruir(finales.data(), finales.size(), nullptr);
+        contado = consultar(distribucion);
+        tConteo = min(tConteo, cronometro.segundos());
+    }
+
+    sistema.distribucion(0);
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        mantenido = consultar(sistema.distribucion(0));
+        tMantenida = min(tMantenida, cronometro.segundos());
+    }
+
+    // Una baja deja vencidos los acumulados; la consulta los recalcula.
+    char matricula[24];
+    for (int r = 0; r < repeticiones; r++) {
+        snprintf(matricula, sizeof(matricula), "A%07d", r + 1);
+        sistema.eliminarPorMatricula(matricula);
+        Cronometro cronometro;
+        trasCambio = consultar(sistema.distribucion(0));
+        tTrasCambio = min(tTrasCambio, cronometro.segundos());
+    }
+    finales.erase(finales.begin(), finales.begin() + repeticiones);
+
+    bool coinciden = ordenado == contado && contado == mantenido &&
+                     trasCambio == porOrdenamiento(finales.data(), finales.size());
+
+    cout << "alumnos: " << filas << endl;
+    cout << left << setw(30) << "metodo" << "tiempo (ms)" << endl;
+    cout << fixed << setprecision(3);
+    cout << setw(30) << "copia + ordenamiento" << tOrdenamiento * 1000 << endl;
+    cout << setw(30) << "conteo en una pasada" << tConteo * 1000 << endl;
+    cout << setw(30) << "distribucion mantenida" << tMantenida * 1000 << endl;
+    cout << setw(30) << "mantenida tras una baja" << tTrasCambio * 1000 << endl;
+    cout << "mediana " << setprecision(2) << mantenido.percentiles[2]
+         << ", resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+// Compara el cálculo de estadísticas recorriendo estructuras Alumno (tres
+// pasadas, como antes) contra una sola pasada sobre la columna de
+// calificaciones finales, escalar y vectorizada, y contra la lectura de las
+// estadísticas incrementales que mantiene el sistema.
+//
+// Compilar con -mavx2 (o -march=native) para usar la ruta AVX2.
+// Uso: ./bench_estadisticas [alumnos] [repeticiones]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+
+static ResumenCalificaciones resumirColumnaEscalar(const double* valores, size_t n, double umbralAprobado) {
+    ResumenCalificaciones resumen = {n, 0.0, 0.0, 0.0, 0.0, 0};
+    if (n == 0) return resumen;
+
+    double minimo = valores[0], maximo = valores[0];
+    for (size_t i = 0; i < n; i++) {
+        double x = valores[i];
+        resumen.suma += x;
+        resumen.sumaCuadrados += x * x;
+        minimo = min(minimo, x);
+        maximo = max(maximo, x);
+        resumen.aprobados += x >= umbralAprobado ? 1 : 0;
+    }
+    resumen.minimo = minimo;
+    resumen.maximo = maximo;
+    return resumen;
+}
+
+
+// Suma, suma de cuadrados, mínimo, máximo y conteo de aprobados en una sola
+// pasada. Usa AVX2 o SSE2 según las opciones de compilación (-mavx2 o
+// -march=native); en otras arquitecturas usa la versión escalar. El sistema
+// ya no recorre la columna (lee las estadísticas incrementales); se conserva
+// aquí como punto de comparación.
+static ResumenCalificaciones resumirColumna(const double* valores, size_t n, double umbralAprobado) {
+#if defined(__AVX2__)
+    if (n < 8) return resumirColumnaEscalar(valores, n, umbralAprobado);
+
+    __m256d suma = _mm256_setzero_pd();
+    __m256d cuadrados = _mm256_setzero_pd();
+    __m256d aprobados = _mm256_setzero_pd();
+    __m256d minimo = _mm256_loadu_pd(valores);
+    __m256d maximo = minimo;
+    const __m256d umbral = _mm256_set1_pd(umbralAprobado);
+    const __m256d uno = _mm256_set1_pd(1.0);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(valores + i);
+        suma = _mm256_add_pd(suma, x);
+        cuadrados = _mm256_add_pd(cuadrados, _mm256_mul_pd(x, x));
+        minimo = _mm256_min_pd(minimo, x);
+        maximo = _mm256_max_pd(maximo, x);
+        aprobados = _mm256_add_pd(aprobados, _mm256_and_pd(_mm256_cmp_pd(x, umbral, _CMP_GE_OQ), uno));
+    }
+
+    double s[4], c[4], mn[4], mx[4], a[4];
+    _mm256_storeu_pd(s, suma);
+    _mm256_storeu_pd(c, cuadrados);
+    _mm256_storeu_pd(mn, minimo);
+    _mm256_storeu_pd(mx, maximo);
+    _mm256_storeu_pd(a, aprobados);
+    const int carriles = 4;
+#elif defined(__SSE2__)
+    if (n < 4) return resumirColumnaEscalar(valores, n, umbralAprobado);
+
+    __m128d suma = _mm_setzero_pd();
+    __m128d cuadrados = _mm_setzero_pd();
+    __m128d aprobados = _mm_setzero_pd();
+    __m128d minimo = _mm_loadu_pd(valores);
+    __m128d maximo = minimo;
+    const __m128d umbral = _mm_set1_pd(umbralAprobado);
+    const __m128d uno = _mm_set1_pd(1.0);
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d x = _mm_loadu_pd(valores + i);
+        suma = _mm_add_pd(suma, x);
+        cuadrados = _mm_add_pd(cuadrados, _mm_mul_pd(x, x));
+        minimo = _mm_min_pd(minimo, x);
+        maximo = _mm_max_pd(maximo, x);
+        aprobados = _mm_add_pd(aprobados, _mm_and_pd(_mm_cmpge_pd(x, umbral), uno));
+    }
+
+    double s[2], c[2], mn[2], mx[2], a[2];
+    _mm_storeu_pd(s, suma);
+    _mm_storeu_pd(c, cuadrados);
+    _mm_storeu_pd(mn, minimo);
+    _mm_storeu_pd(mx, maximo);
+    _mm_storeu_pd(a, aprobados);
+    const int carriles = 2;
+#else
+    return resumirColumnaEscalar(valores, n, umbralAprobado);
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    ResumenCalificaciones resumen = resumirColumnaEscalar(valores + i, n - i, umbralAprobado);
+    if (resumen.cantidad == 0) {
+        resumen.minimo = mn[0];
+        resumen.maximo = mx[0];
+    }
+    resumen.cantidad = n;
+    for (int k = 0; k < carriles; k++) {
+        resumen.suma += s[k];
+        resumen.sumaCuadrados += c[k];
+        resumen.minimo = min(resumen.minimo, mn[k]);
+        resumen.maximo = max(resumen.maximo, mx[k]);
+        resumen.aprobados += static_cast<size_t>(a[k]);
+    }
+    return resumen;
+#endif
+}
+
+
+struct Estadisticas {
+    double promedio;
+    double desviacion;
+    double maximo;
+    double minimo;
+    int aprobados;
+};
+
+
+static Estadisticas estadisticasPorEstructuras(const vector<AlumnoAnterior>& alumnos) {
+    int n = static_cast<int>(alumnos.size());
+    Estadisticas e = {};
+
+    double suma = 0.0;
+    for (int i = 0; i < n; i++) suma += alumnos[i].calificacionFinal;
+    e.promedio = round((suma / n) * 100.0) / 100.0;
+
+    double sumaCuadrados = 0.0;
+    for (int i = 0; i < n; i++) {
+        double diferencia = alumnos[i].calificacionFinal - e.promedio;
+        sumaCuadrados += diferencia * diferencia;
+    }
+    e.desviacion = round(sqrt(sumaCuadrados / n) * 100.0) / 100.0;
+
+    e.aprobados = 0;
+    e.maximo = 0;
+    e.minimo = 100;
+    for (int i = 0; i < n; i++) {
+        if (alumnos[i].estaAprobado()) e.aprobados++;
+        if (alumnos[i].calificacionFinal > e.maximo) e.maximo = alumnos[i].calificacionFinal;
+        if (alumnos[i].calificacionFinal < e.minimo) e.minimo = alumnos[i].calificacionFinal;
+    }
+    return e;
+}
+
+
+static Estadisticas estadisticasDe(const ResumenCalificaciones& r) {
+    Estadisticas e = {};
+    e.promedio = SistemaAdministrativo::promedioDe(r);
+    e.desviacion = SistemaAdministrativo::desviacionDe(r);
+    e.maximo = r.maximo;
+    e.minimo = r.minimo;
+    e.aprobados = static_cast<int>(r.aprobados);
+    return e;
+}
+
+
+template <class Funcion>
+static double mejorTiempo(int repeticiones, Funcion funcion, Estadisticas& resultado) {
+    double mejor = 1e30;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        resultado = funcion();
+        mejor = min(mejor, cronometro.segundos());
+    }
+    return mejor;
+}
+
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 20;
+
+    mt19937 generador(42);
+    uniform_int_distribution<int> decimas(0, 1000);
+    vector<AlumnoAnterior> alumnos;
+    ColumnasCalificaciones columnas;
+    EstadisticasIncrementales incrementales(CALIFICACION_APROBATORIA);
+    alumnos.reserve(n);
+    columnas.reservar(n);
+    for (size_t i = 0; i < n; i++) {
+        AlumnoAnterior alumno("Alumno de prueba " + to_string(i), "A" + to_string(i),
+                              decimas(generador) / 10.0, decimas(generador) / 10.0, decimas(generador) / 10.0);
+        columnas.agregar(alumno.calificacion1, alumno.calificacion2, alumno.calificacion3,
+                         alumno.calificacionFinal);
+        incrementales.agregar(aCentesimas(alumno.calificacionFinal));
+        alumnos.push_back(alumno);
+    }
+
+    Estadisticas porEstructuras = {}, escalar = {}, vectorizada = {}, incremental = {};
+    double tEstructuras = mejorTiempo(repeticiones, [&] { return estadisticasPorEstructuras(alumnos); }, porEstructuras);
+    double tEscalar = mejorTiempo(repeticiones, [&] {
+        return estadisticasDe(resumirColumnaEscalar(columnas.finales(), n, CALIFICACION_APROBATORIA));
+    }, escalar);
+    double tVectorizada = mejorTiempo(repeticiones, [&] {
+        return estadisticasDe(resumirColumna(columnas.finales(), n, CALIFICACION_APROBATORIA));
+    }, vectorizada);
+    double tIncremental = mejorTiempo(repeticiones, [&] {
+        return estadisticasDe(incrementales.resumen());
+    }, incremental);
+
+#if defined(__AVX2__)
+    const char* ruta = "AVX2";
+#elif defined(__SSE2__)
+    const char* ruta = "SSE2";
+#else
+    const char* ruta = "escalar";
+#endif
+
+    cout << "alumnos: " << n << ", ruta vectorizada: " << ruta << endl;
+    cout << left << setw(26) << "metodo" << setw(14) << "tiempo (ms)" << "aceleracion" << endl;
+    cout << fixed << setprecision(3);
+    cout << setw(26) << "estructuras (3 pasadas)" << setw(14) << tEstructuras * 1000 << "1.0x" << endl;
+    cout << setw(26) << "columna escalar" << setw(14) << tEscalar * 1000
+         << setprecision(1) << tEstructuras / tEscalar << "x" << setprecision(3) << endl;
+    cout << setw(26) << "columna vectorizada" << setw(14) << tVectorizada * 1000
+         << setprecision(1) << tEstructuras / tVectorizada << "x" << setprecision(3) << endl;
+    cout << setw(26) << "incremental (lectura)" << setw(14) << tIncremental * 1000
+         << setprecision(0) << tEstructuras / tIncremental << "x" << endl;
+
+    bool coinciden = true;
+    for (const Estadisticas* e : {&vectorizada, &incremental}) {
+        coinciden = coinciden && porEstructuras.promedio == e->promedio &&
+                    porEstructuras.desviacion == e->desviacion &&
+                    porEstructuras.maximo == e->maximo &&
+                    porEstructuras.minimo == e->minimo &&
+                    porEstructuras.aprobados == e->aprobados;
+    }
+    cout << "resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
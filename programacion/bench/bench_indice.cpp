@@ -0,0 +1,103 @@
+// Compara el tiempo de carga de alumnos.txt con la detección de duplicados
+// por búsqueda lineal (implementación anterior) contra el índice hash.
+//
+// Uso: ./bench_indice [--max-lineal N]
+//   --max-lineal N  tamaño máximo para el que se mide la versión lineal
+//                   (es O(N²); por omisión 100000).
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+
+// Réplica del cargador anterior: getline + substr + stod y búsqueda lineal
+// de duplicados sobre los alumnos ya cargados.
+static int cargarConBusquedaLineal(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo);
+    if (!archivo.is_open()) return -1;
+
+    vector<AlumnoAnterior> alumnos;
+    string linea;
+    while (getline(archivo, linea)) {
+        linea.erase(0, linea.find_first_not_of(" \t\n\r"));
+        linea.erase(linea.find_last_not_of(" \t\n\r") + 1);
+        if (linea.empty()) continue;
+
+        size_t pos1 = linea.find('|');
+        size_t pos2 = linea.find('|', pos1 + 1);
+        size_t pos3 = linea.find('|', pos2 + 1);
+        size_t pos4 = linea.find('|', pos3 + 1);
+        if (pos1 == string::npos || pos2 == string::npos ||
+            pos3 == string::npos || pos4 == string::npos) continue;
+
+        string nombre = linea.substr(0, pos1);
+        string matricula = linea.substr(pos1 + 1, pos2 - pos1 - 1);
+        double cal1 = stod(linea.substr(pos2 + 1, pos3 - pos2 - 1));
+        double cal2 = stod(linea.substr(pos3 + 1, pos4 - pos3 - 1));
+        double cal3 = stod(linea.substr(pos4 + 1));
+
+        bool duplicado = false;
+        for (size_t i = 0; i < alumnos.size(); i++) {
+            if (alumnos[i].matricula == matricula) {
+                duplicado = true;
+                break;
+            }
+        }
+        if (duplicado) continue;
+
+        alumnos.push_back(AlumnoAnterior(nombre, matricula, cal1, cal2, cal3));
+    }
+    return static_cast<int>(alumnos.size());
+}
+
+
+int main(int argc, char* argv[]) {
+    long maxLineal = 100000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max-lineal") == 0 && i + 1 < argc) {
+            maxLineal = atol(argv[++i]);
+        }
+    }
+
+    const long tamanos[] = {10000, 100000, 1000000};
+    const string archivo = "bench_indice.tmp";
+
+    cout << left << setw(10) << "filas"
+         << setw(16) << "lineal (s)"
+         << setw(16) << "indice (s)"
+         << "aceleracion" << endl;
+
+    for (long filas : tamanos) {
+        if (!generarArchivoAlumnos(archivo, filas)) {
+            cerr << "Error: No se pudo generar " << archivo << endl;
+            return 1;
+        }
+
+        Cronometro cronometro;
+        SistemaAdministrativo sistema;
+        sistema.cargarDesdeArchivo(archivo);
+        double tiempoIndice = cronometro.segundos();
+
+        cout << left << setw(10) << filas;
+        if (filas <= maxLineal) {
+            cronometro.reiniciar();
+            cargarConBusquedaLineal(archivo);
+            double tiempoLineal = cronometro.segundos();
+            cout << setw(16) << fixed << setprecision(4) << tiempoLineal
+                 << setw(16) << tiempoIndice
+                 << setprecision(1) << (tiempoLineal / tiempoIndice) << "x" << endl;
+        } else {
+            cout << setw(16) << "omitido"
+                 << setw(16) << fixed << setprecision(4) << tiempoIndice << "-" << endl;
+        }
+    }
+
+    remove(archivo.c_str());
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Tiempo y memoria máxima residente de una carga de alumnos.txt. Cada
+// ejecución mide una sola carga, porque el máximo residente del proceso no
+// disminuye.
+//
+// Uso: ./bench_memoria [filas] [hilos]
+
+#include "../sistema_core.h"
+#include "comun.h"
+
+#include <cstdlib>
+
+#include <sys/resource.h>
+
+using namespace std;
+
+
+static double megabytesResidentesMaximos() {
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+#ifdef __APPLE__
+    return uso.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return uso.ru_maxrss / 1024.0;
+#endif
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int hilos = argc > 2 ? atoi(argv[2]) : 1;
+    const string archivo = "bench_memoria.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+    double antes = megabytesResidentesMaximos();
+
+    Cronometro cronometro;
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo, hilos);
+    double tiempo = cronometro.segundos();
+    remove(archivo.c_str());
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << ", hilos: " << hilos << endl;
+    cout << fixed << setprecision(3) << "carga (s): " << tiempo << endl;
+    cout << setprecision(1) << "memoria maxima (MB): " << megabytesResidentesMaximos()
+         << " (antes de cargar: " << antes << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Búsqueda de alumnos por nombre: recorrido de todo el registro
+// normalizando cada nombre frente al índice de trigramas, para búsquedas
+// de distinta selectividad.
+//
+// Uso: ./bench_nombres [alumnos] [repeticiones]
+
+#include "../sistema_core.h"
+#include "comun.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+
+// Sin índice: normaliza cada nombre y busca el patrón.
+static vector<int> buscarPorRecorrido(const vector<string>& nombres, string_view texto, bool prefijo) {
+    string patron, nombre;
+    normalizarNombre(texto, patron);
+    if (!prefijo) patron.erase(0, 1);
+
+    vector<int> posiciones;
+    for (size_t i = 0; i < nombres.size(); i++) {
+        normalizarNombre(nombres[i], nombre);
+        if (nombre.find(patron) != string::npos) posiciones.push_back(static_cast<int>(i));
+    }
+    return posiciones;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 5;
+    const string archivo = "bench_nombres.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+    // Unos pocos nombres poco comunes para las búsquedas selectivas.
+    {
+        ofstream extra(archivo, ios::app);
+        for (int i = 0; i < 100; i++) {
+            extra << "Iñaki Zúñiga Ortiz|Z" << i << "|80|80|80\n";
+        }
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+    vector<string> nombres;
+    nombres.reserve(filas + 100);
+    ifstream entrada(archivo);
+    string linea;
+    while (getline(entrada, linea)) {
+        nombres.push_back(linea.substr(0, linea.find('|')));
+    }
+    remove(archivo.c_str());
+
+    Cronometro cronometro;
+    sistema.buscarPorNombre("zzz", false);
+    double tConstruccion = cronometro.segundos();
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << endl;
+    cout << "construccion del indice: " << fixed << setprecision(1) << tConstruccion * 1000 << " ms" << endl;
+    cout << left << setw(26) << "busqueda" << setw(12) << "alumnos" << setw(18) << "recorrido (ms)"
+         << setw(16) << "indice (ms)" << "aceleracion" << endl;
+
+    struct Busqueda {
+        const char* texto;
+        bool prefijo;
+    };
+    const Busqueda busquedas[] = {
+        {"zuñiga", true}, {"IÑAKI ZUNIGA", false}, {"sofia ramirez", false}, {"martinez", true}, {"nez", false}
+    };
+
+    bool coinciden = true;
+    for (const Busqueda& busqueda : busquedas) {
+        vector<int> porRecorrido, porIndice;
+        double tRecorrido = 1e30, tIndice = 1e30;
+        for (int r = 0; r < repeticiones; r++) {
+            cronometro.reiniciar();
+            porRecorrido = buscarPorRecorrido(nombres, busqueda.texto, busqueda.prefijo);
+            tRecorrido = min(tRecorrido, cronometro.segundos());
+
+            cronometro.reiniciar();
+            porIndice = sistema.buscarPorNombre(busqueda.texto, busqueda.prefijo);
+            tIndice = min(tIndice, cronometro.segundos());
+        }
+        coinciden = coinciden && porRecorrido == porIndice;
+
+        string etiqueta = string(busqueda.prefijo ? "prefijo " : "contiene ") + busqueda.texto;
+        cout << setw(26) << etiqueta << setw(12) << porIndice.size()
+             << setprecision(3) << setw(18) << tRecorrido * 1000 << setw(16) << tIndice * 1000
+             << setprecision(1) << tRecorrido / tIndice << "x" << endl;
+    }
+
+    cout << "resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
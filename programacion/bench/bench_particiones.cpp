@@ -0,0 +1,204 @@
+// Consultas de todo el registro (promedio y desviación, mejores 10,
+// aprobados y reprobados) y búsquedas por matrícula sobre un solo
+// SistemaAdministrativo frente a RegistroParticionado con 1, 2, 4 y 8
+// particiones repartidas en el grupo de hilos. Comprueba que todas las
+// configuraciones den los mismos resultados, incluidas las matrículas de los
+// 1000 mejores y peores, con los empates ordenados por matrícula.
+//
+// Uso: ./bench_particiones [alumnos] [repeticiones]
+
+#include "../registro_particionado.h"
+#include "comun.h"
+
+#include <cstdlib>
+#include <thread>
+
+using namespace std;
+
+
+// Con 1000 hay empates en el corte, que es lo que se quiere comprobar.
+const size_t EXTREMOS_EMPATES = 1000;
+
+
+struct Resultados {
+    double promedio;
+    double desviacion;
+    vector<double> mejores;
+    vector<string> extremos;
+    size_t aprobados;
+    size_t reprobados;
+    long encontrados;
+};
+
+
+struct Tiempos {
+    double estadisticas;
+    double mejores;
+    double listas;
+    double busquedas;
+};
+
+
+template <typename F>
+static double mejorTiempo(int repeticiones, F&& operacion) {
+    double mejor = 1e30;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        operacion();
+        mejor = min(mejor, cronometro.segundos());
+    }
+    return mejor;
+}
+
+
+// Mide las mismas consultas sobre `registro`, que puede ser un
+// SistemaAdministrativo o un RegistroParticionado.
+template <typename Registro, typename Listas>
+static Tiempos medir(Registro& registro, Listas listas, const vector<string>& matriculas, int repeticiones,
+                     Resultados& resultados) {
+    Tiempos tiempos;
+    tiempos.estadisticas = mejorTiempo(repeticiones, [&] {
+        resultados.promedio = registro.calcularPromedioGeneral();
+        resultados.desviacion = registro.calcularDesviacionEstandar();
+    });
+    tiempos.mejores = mejorTiempo(repeticiones, [&] {
+        resultados.mejores.clear();
+        for (const FichaAlumno& ficha : registro.fichasExtremas(10, true)) {
+            resultados.mejores.push_back(ficha.calificacionFinal);
+        }
+    });
+    tiempos.listas = mejorTiempo(repeticiones, [&] { listas(resultados); });
+    tiempos.busquedas = mejorTiempo(repeticiones, [&] {
+        FichaAlumno ficha;
+        resultados.encontrados = 0;
+        for (const string& matricula : matriculas) {
+            resultados.encontrados += registro.buscar(matricula, ficha);
+        }
+    });
+    return tiempos;
+}
+
+
+// Matrículas de los K mejores y de los K peores, para comparar también a
+// quiénes se eligió en los empates.
+template <typename Registro>
+static vector<string> matriculasExtremas(const Registro& registro, size_t k) {
+    vector<string> matriculas;
+    for (bool mejores : {true, false}) {
+        for (const FichaAlumno& ficha : registro.fichasExtremas(k, mejores)) matriculas.push_back(ficha.matricula);
+    }
+    return matriculas;
+}
+
+
+// Referencia: todos los alumnos ordenados por calificación y matrícula.
+static vector<string> matriculasExtremas(vector<FichaAlumno> fichas, size_t k) {
+    vector<string> matriculas;
+    for (bool mejores : {true, false}) {
+        size_t cantidad = min(k, fichas.size());
+        partial_sort(fichas.begin(), fichas.begin() + cantidad, fichas.end(),
+                     [mejores](const FichaAlumno& a, const FichaAlumno& b) {
+                         if (a.calificacionFinal != b.calificacionFinal) {
+                             return mejores ? a.calificacionFinal > b.calificacionFinal
+                                            : a.calificacionFinal < b.calificacionFinal;
+                         }
+                         return a.matricula < b.matricula;
+                     });
+        for (size_t i = 0; i < cantidad; i++) matriculas.push_back(fichas[i].matricula);
+    }
+    return matriculas;
+}
+
+
+static bool mismosResultados(const Resultados& a, const Resultados& b) {
+    return a.promedio == b.promedio && a.desviacion == b.desviacion && a.mejores == b.mejores &&
+           a.extremos == b.extremos && a.aprobados == b.aprobados && a.reprobados == b.reprobados && a.encontrados == b.encontrados;
+}
+
+
+static void imprimir(const string& metodo, const Tiempos& t, size_t busquedas) {
+    cout << setw(18) << metodo << setw(16) << t.estadisticas * 1000 << setw(14) << t.mejores * 1000
+         << setw(16) << t.listas * 1000 << busquedas / t.busquedas << endl;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 5;
+    const string archivo = "bench_particiones.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    // Las matrículas se generan en orden; con las líneas invertidas el orden
+    // del registro ya no es el de las matrículas, y un desempate por posición
+    // no coincidiría con la referencia.
+    {
+        vector<string> lineas;
+        ifstream entrada(archivo);
+        string linea;
+        while (getline(entrada, linea)) lineas.push_back(linea);
+        entrada.close();
+        ofstream salida(archivo);
+        for (size_t i = lineas.size(); i-- > 0;) salida << lineas[i] << '\n';
+    }
+
+    mt19937 generador(7);
+    vector<string> matriculas(100000);
+    char matricula[24];
+    for (size_t i = 0; i < matriculas.size(); i++) {
+        snprintf(matricula, sizeof(matricula), "A%07ld", static_cast<long>(generador() % filas) + 1);
+        matriculas[i] = matricula;
+    }
+
+    cout << "alumnos: " << filas << ", nucleos: " << thread::hardware_concurrency() << endl;
+    cout << left << setw(18) << "metodo" << setw(16) << "promedio (ms)" << setw(14) << "top 10 (ms)"
+         << setw(16) << "listas (ms)" << "busquedas/s" << endl;
+    cout << fixed << setprecision(3);
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+    Resultados base;
+    // Las listas se convierten a fichas, como las que devuelve el registro
+    // particionado.
+    auto fichas = [&sistema](const vector<int>& posiciones) {
+        vector<FichaAlumno> resultado;
+        resultado.reserve(posiciones.size());
+        for (int posicion : posiciones) resultado.push_back(sistema.fichaDe(posicion));
+        return resultado;
+    };
+    Tiempos tiempos = medir(sistema, [&](Resultados& r) {
+        r.aprobados = fichas(sistema.alumnosAprobados()).size();
+        r.reprobados = fichas(sistema.alumnosReprobados()).size();
+    }, matriculas, repeticiones, base);
+    imprimir("un registro", tiempos, matriculas.size());
+    // Un solo registro desempata por posición, así que para él se ordena a
+    // todos los alumnos.
+    vector<FichaAlumno> todos = fichas(sistema.alumnosAprobados());
+    vector<FichaAlumno> reprobados = fichas(sistema.alumnosReprobados());
+    todos.insert(todos.end(), reprobados.begin(), reprobados.end());
+    base.extremos = matriculasExtremas(move(todos), EXTREMOS_EMPATES);
+
+    bool coinciden = true;
+    for (int particiones : {1, 2, 4, 8}) {
+        RegistroParticionado registro(particiones);
+        int rechazados = 0;
+        registro.importar(archivo, rechazados);
+
+        Resultados resultados;
+        tiempos = medir(registro, [&](Resultados& r) {
+            r.aprobados = registro.alumnosAprobados().size();
+            r.reprobados = registro.alumnosReprobados().size();
+        }, matriculas, repeticiones, resultados);
+        imprimir(to_string(particiones) + " particiones", tiempos, matriculas.size());
+        resultados.extremos = matriculasExtremas(registro, EXTREMOS_EMPATES);
+        coinciden = coinciden && registro.getCantidadAlumnos() == sistema.getCantidadAlumnos() &&
+                    mismosResultados(base, resultados);
+    }
+    remove(archivo.c_str());
+
+    cout << "resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
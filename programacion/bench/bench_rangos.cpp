@@ -0,0 +1,103 @@
+// Consultas por rango de calificación final: recorrido completo del
+// registro (como hacían los listados de aprobados y reprobados) frente al
+// índice ordenado, para rangos de distinto ancho.
+//
+// Uso: ./bench_rangos [alumnos] [consultas]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <random>
+
+using namespace std;
+
+
+// Réplica del recorrido anterior: revisa todos los alumnos.
+static vector<int> rangoPorRecorrido(const vector<AlumnoAnterior>& alumnos, double minimo, double maximo) {
+    vector<int> posiciones;
+    for (size_t i = 0; i < alumnos.size(); i++) {
+        double calificacion = alumnos[i].calificacionFinal;
+        if (calificacion >= minimo && calificacion <= maximo) {
+            posiciones.push_back(static_cast<int>(i));
+        }
+    }
+    return posiciones;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int consultas = argc > 2 ? atoi(argv[2]) : 200;
+    const string archivo = "bench_rangos.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+
+    // El archivo generado no tiene líneas inválidas ni duplicadas, así que
+    // la réplica queda en el mismo orden que el registro.
+    vector<AlumnoAnterior> alumnos;
+    alumnos.reserve(filas);
+    ifstream entrada(archivo);
+    string linea;
+    while (getline(entrada, linea)) {
+        LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+        alumnos.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula),
+                                         datos.calificacion1, datos.calificacion2, datos.calificacion3));
+    }
+    remove(archivo.c_str());
+
+    Cronometro cronometro;
+    sistema.alumnosEnRango(0, CALIFICACION_MAX, CALIFICACION_MAX);
+    double tConstruccion = cronometro.segundos();
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << ", consultas por ancho: " << consultas << endl;
+    cout << "construccion del indice: " << fixed << setprecision(1) << tConstruccion * 1000 << " ms" << endl;
+    cout << left << setw(10) << "ancho" << setw(14) << "promedio k" << setw(18) << "recorrido (ms)"
+         << setw(16) << "indice (ms)" << "aceleracion" << endl;
+
+    const double anchos[] = {0.1, 1.0, 10.0, 30.0};
+    mt19937 generador(7);
+    bool coinciden = true;
+    for (double ancho : anchos) {
+        uniform_real_distribution<double> inicio(CALIFICACION_MIN, CALIFICACION_MAX - ancho);
+        vector<double> minimos(consultas);
+        for (int i = 0; i < consultas; i++) {
+            minimos[i] = inicio(generador);
+        }
+
+        size_t total = 0, encontrados = 0;
+        cronometro.reiniciar();
+        for (int i = 0; i < consultas; i++) {
+            total += rangoPorRecorrido(alumnos, minimos[i], minimos[i] + ancho).size();
+        }
+        double tRecorrido = cronometro.segundos();
+
+        cronometro.reiniciar();
+        for (int i = 0; i < consultas; i++) {
+            vector<int> posiciones = sistema.alumnosEnRango(0, minimos[i], minimos[i] + ancho);
+            total -= posiciones.size();
+            encontrados += posiciones.size();
+        }
+        double tIndice = cronometro.segundos();
+        coinciden = coinciden && total == 0;
+
+        vector<int> porIndice = sistema.alumnosEnRango(0, minimos[0], minimos[0] + ancho);
+        sort(porIndice.begin(), porIndice.end());
+        coinciden = coinciden && porIndice == rangoPorRecorrido(alumnos, minimos[0], minimos[0] + ancho);
+
+        cout << setw(10) << setprecision(1) << ancho << setw(14) << encontrados / consultas
+             << setprecision(3) << setw(18) << tRecorrido * 1000 / consultas
+             << setw(16) << tIndice * 1000 / consultas
+             << setprecision(1) << tRecorrido / tIndice << "x" << endl;
+    }
+
+    cout << "resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+// Compara la consulta de mejores calificaciones por copia y ordenamiento de
+// burbuja (implementación anterior) contra la selección con montículo
+// acotado y contra el índice de ranking mantenido.
+//
+// Uso: ./bench_ranking [alumnos] [k] [--max-burbuja N]
+//   --max-burbuja N  tamaño máximo para el que se mide la versión anterior
+//                    (es O(N²); por omisión 10000).
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+
+// Réplica de top3MejoresCalificaciones anterior: copia todos los alumnos y
+// los ordena con burbuja.
+static vector<string> mejoresPorBurbuja(const vector<AlumnoAnterior>& alumnos, size_t k) {
+    int n = static_cast<int>(alumnos.size());
+    AlumnoAnterior* copia = new AlumnoAnterior[n];
+    for (int i = 0; i < n; i++) {
+        copia[i] = alumnos[i];
+    }
+
+    bool intercambio;
+    for (int i = 0; i < n - 1; i++) {
+        intercambio = false;
+        for (int j = 0; j < n - i - 1; j++) {
+            if (copia[j].calificacionFinal < copia[j + 1].calificacionFinal) {
+                AlumnoAnterior temp = copia[j];
+                copia[j] = copia[j + 1];
+                copia[j + 1] = temp;
+                intercambio = true;
+            }
+        }
+        if (!intercambio) break;
+    }
+
+    vector<string> matriculas;
+    for (int i = 0; i < min(static_cast<int>(k), n); i++) {
+        matriculas.push_back(copia[i].matricula);
+    }
+    delete[] copia;
+    return matriculas;
+}
+
+
+int main(int argc, char* argv[]) {
+    vector<long> posicionales;
+    long maxBurbuja = 10000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max-burbuja") == 0 && i + 1 < argc) {
+            maxBurbuja = atol(argv[++i]);
+        } else {
+            posicionales.push_back(atol(argv[i]));
+        }
+    }
+    long filas = posicionales.size() > 0 ? posicionales[0] : 500000;
+    size_t k = posicionales.size() > 1 ? posicionales[1] : 10;
+    const string archivo = "bench_ranking.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    // Réplica en un vector<AlumnoAnterior>, en el mismo orden que el registro
+    // (el archivo generado no tiene líneas inválidas ni duplicadas).
+    vector<AlumnoAnterior> alumnos;
+    if (filas <= maxBurbuja) {
+        ifstream entrada(archivo);
+        string linea;
+        while (getline(entrada, linea)) {
+            LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+            alumnos.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula),
+                                             datos.calificacion1, datos.calificacion2, datos.calificacion3));
+        }
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+    // El índice de ranking se llena durante la carga.
+    SistemaAdministrativo conRanking;
+    conRanking.mantenerRanking(true);
+    Cronometro cronometro;
+    conRanking.cargarDesdeArchivo(archivo);
+    double tCargaConIndice = cronometro.segundos();
+    remove(archivo.c_str());
+
+    cronometro.reiniciar();
+    vector<int> porMonticulo = sistema.extremosCalificacion(k, true);
+    double tMonticulo = cronometro.segundos();
+
+    cronometro.reiniciar();
+    vector<int> peores = sistema.extremosCalificacion(k, false);
+    double tPeores = cronometro.segundos();
+
+    cronometro.reiniciar();
+    vector<int> porIndice = conRanking.extremosCalificacion(k, true);
+    double tIndice = cronometro.segundos();
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << ", k: " << k << endl;
+    cout << left << setw(28) << "metodo" << "tiempo (ms)" << endl;
+    cout << fixed << setprecision(3);
+    cout << setw(28) << "monticulo (mejores)" << tMonticulo * 1000 << endl;
+    cout << setw(28) << "monticulo (peores)" << tPeores * 1000 << endl;
+    cout << setw(28) << "indice (consulta)" << tIndice * 1000 << endl;
+    cout << setw(28) << "carga con indice" << tCargaConIndice * 1000 << endl;
+
+    bool coinciden = porMonticulo == porIndice;
+    if (filas <= maxBurbuja) {
+        cronometro.reiniciar();
+        vector<string> porBurbuja = mejoresPorBurbuja(alumnos, k);
+        cout << setw(28) << "copia + burbuja" << cronometro.segundos() * 1000 << endl;
+        for (size_t i = 0; i < porBurbuja.size(); i++) {
+            coinciden = coinciden && alumnos[porMonticulo[i]].matricula == porBurbuja[i];
+        }
+    } else {
+        cout << setw(28) << "copia + burbuja" << "omitido" << endl;
+    }
+
+    cout << "resultados " << (coinciden ? "coinciden" : "NO coinciden") << endl;
+    return coinciden ? 0 : 1;
+}
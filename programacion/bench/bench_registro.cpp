@@ -0,0 +1,168 @@
+// Banco de regresión del registro: genera registros sintéticos de varios
+// tamaños y tasas de corrupción y mide las operaciones principales de la
+// API (carga, guardado, búsqueda por matrícula, baja, top 3 y reporte).
+// Imprime una línea por operación, campos separados por '|', con la
+// latencia por muestra en percentiles y el rendimiento con la mediana,
+// para comparar versiones con un diff o una hoja de cálculo:
+//
+//   formato|1
+//   operacion|alumnos|corrupcion|muestras|p50_us|p90_us|p99_us|max_us|por_segundo
+//
+// `por_segundo` son alumnos por segundo en carga, guardado, top3 y reporte
+// (recorren todo el registro) y operaciones por segundo en buscar y baja.
+// Los avisos de las líneas dañadas van a la salida de errores.
+//
+// Uso: ./bench_registro [alumnos,...] [corrupcion,...] [operaciones] [repeticiones]
+//      ./bench_registro 10000,100000,1000000 0,0.05 100000 5 2>/dev/null
+
+#include "../sistema_core.h"
+#include "comun.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+
+static const int VERSION_FORMATO = 1;
+
+
+static vector<double> leerLista(const char* texto) {
+    vector<double> valores;
+    stringstream entrada(texto);
+    string valor;
+    while (getline(entrada, valor, ',')) {
+        valores.push_back(atof(valor.c_str()));
+    }
+    return valores;
+}
+
+
+// Percentil por rango más cercano sobre muestras ya ordenadas.
+static double percentil(const vector<double>& ordenadas, double p) {
+    size_t rango = static_cast<size_t>(ceil(p / 100.0 * ordenadas.size()));
+    return ordenadas[rango > 0 ? rango - 1 : 0];
+}
+
+
+// `muestras` en segundos; `elementos` es lo que procesa cada muestra.
+static void imprimirMedicion(const char* operacion, long alumnos, double corrupcion, vector<double> muestras,
+                             double elementos) {
+    sort(muestras.begin(), muestras.end());
+    double mediana = percentil(muestras, 50);
+    cout << operacion << '|' << alumnos << '|' << setprecision(4) << corrupcion << '|' << muestras.size()
+         << fixed << setprecision(3) << '|' << mediana * 1e6 << '|' << percentil(muestras, 90) * 1e6
+         << '|' << percentil(muestras, 99) * 1e6 << '|' << muestras.back() * 1e6 << '|' << setprecision(0)
+         << (mediana > 0 ? elementos / mediana : 0.0) << defaultfloat << '\n';
+}
+
+
+template <typename F>
+static vector<double> medirVeces(int veces, F&& operacion) {
+    vector<double> muestras;
+    muestras.reserve(veces);
+    for (int i = 0; i < veces; i++) {
+        Cronometro cronometro;
+        operacion(i);
+        muestras.push_back(cronometro.segundos());
+    }
+    return muestras;
+}
+
+
+// Mide un registro; devuelve false si la carga no descartó exactamente las
+// líneas dañadas.
+static bool medirRegistro(long filas, double corrupcion, int operaciones, int repeticiones) {
+    const string archivo = "bench_registro.tmp";
+    const string guardado = "bench_registro_guardado.tmp";
+    const string reporte = "bench_registro_reporte.tmp";
+
+    long corruptas = 0;
+    if (!generarArchivoAlumnos(archivo, filas, 42, corrupcion, &corruptas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return false;
+    }
+
+    SistemaAdministrativo sistema;
+    vector<double> carga = medirVeces(repeticiones, [&](int) { sistema.cargarDesdeArchivo(archivo); });
+    remove(archivo.c_str());
+    bool correcto = sistema.getCantidadAlumnos() == filas - corruptas;
+    if (!correcto) {
+        cerr << "Error: se cargaron " << sistema.getCantidadAlumnos() << " alumnos de " << filas - corruptas
+             << " válidos." << endl;
+    }
+    imprimirMedicion("carga", filas, corrupcion, carga, static_cast<double>(filas));
+
+    vector<double> escritura = medirVeces(repeticiones, [&](int) { sistema.guardarEnArchivo(guardado); });
+    remove(guardado.c_str());
+    imprimirMedicion("guardado", filas, corrupcion, escritura, sistema.getCantidadAlumnos());
+
+    // Matrículas al azar; una de cada diez no existe.
+    mt19937 generador(7);
+    vector<string> matriculas(operaciones);
+    char matricula[24];
+    for (int i = 0; i < operaciones; i++) {
+        long numero = static_cast<long>(generador() % filas) + 1;
+        snprintf(matricula, sizeof(matricula), i % 10 == 9 ? "X%07ld" : "A%07ld", numero);
+        matriculas[i] = matricula;
+    }
+    long encontrados = 0;
+    vector<double> busqueda = medirVeces(operaciones, [&](int i) {
+        encontrados += sistema.buscarIndice(matriculas[i]) != -1;
+    });
+    imprimirMedicion("buscar", filas, corrupcion, busqueda, 1.0);
+
+    vector<double> top3 = medirVeces(repeticiones, [&](int) { sistema.extremosCalificacion(3, true); });
+    imprimirMedicion("top3", filas, corrupcion, top3, sistema.getCantidadAlumnos());
+
+    vector<double> reportes = medirVeces(repeticiones, [&](int) { sistema.escribirReporteGeneral(reporte); });
+    remove(reporte.c_str());
+    imprimirMedicion("reporte", filas, corrupcion, reportes, sistema.getCantidadAlumnos());
+
+    // Las bajas van al final porque vacían el registro; cada matrícula se
+    // da de baja una sola vez.
+    vector<string> bajas;
+    long paso = max(1L, filas / operaciones);
+    for (long i = 1; i <= filas && static_cast<int>(bajas.size()) < operaciones; i += paso) {
+        snprintf(matricula, sizeof(matricula), "A%07ld", i);
+        if (sistema.buscarIndice(matricula) != -1) bajas.push_back(matricula);
+    }
+    shuffle(bajas.begin(), bajas.end(), generador);
+    vector<double> baja = medirVeces(static_cast<int>(bajas.size()), [&](int i) {
+        sistema.eliminarPorMatricula(bajas[i]);
+    });
+    if (!baja.empty()) imprimirMedicion("baja", filas, corrupcion, baja, 1.0);
+
+    return correcto && encontrados > 0;
+}
+
+
+int main(int argc, char* argv[]) {
+    vector<double> tamanos = leerLista(argc > 1 ? argv[1] : "10000,100000,1000000");
+    vector<double> corrupciones = leerLista(argc > 2 ? argv[2] : "0,0.05");
+    int operaciones = argc > 3 ? atoi(argv[3]) : 100000;
+    int repeticiones = argc > 4 ? atoi(argv[4]) : 5;
+    if (operaciones < 1 || repeticiones < 1) {
+        cerr << "Uso: " << argv[0] << " [alumnos,...] [corrupcion,...] [operaciones] [repeticiones]" << endl;
+        return 1;
+    }
+
+    cout << "formato|" << VERSION_FORMATO << '\n';
+    cout << "operacion|alumnos|corrupcion|muestras|p50_us|p90_us|p99_us|max_us|por_segundo\n";
+    bool correcto = true;
+    for (double tamano : tamanos) {
+        for (double corrupcion : corrupciones) {
+            long filas = static_cast<long>(tamano);
+            if (filas < 2 || corrupcion < 0.0 || corrupcion >= 1.0) {
+                cerr << "Error: tamaño " << tamano << " o corrupción " << corrupcion << " inválidos." << endl;
+                correcto = false;
+                continue;
+            }
+            correcto = medirRegistro(filas, corrupcion, operaciones, repeticiones) && correcto;
+            cout << flush;
+        }
+    }
+    return correcto ? 0 : 1;
+}
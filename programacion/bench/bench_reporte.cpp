@@ -0,0 +1,172 @@
+// Tiempo de generación del reporte general con ofstream y endl por línea
+// (implementación anterior) frente al escritor con búfer grande y to_chars,
+// en un hilo y formateando partes del reporte en varios hilos.
+//
+// Uso: ./bench_reporte [alumnos] [repeticiones] [hilos]
+
+#include "../sistema_core.h"
+#include "comun.h"
+#include "alumno_anterior.h"
+
+#include <cstdlib>
+#include <thread>
+
+using namespace std;
+
+
+// Réplica de generarReporteGeneral anterior: un vaciado por línea y el
+// estado de formato del flujo en cada alumno.
+static bool reportePorFlujo(const vector<AlumnoAnterior>& alumnos, const ResumenCalificaciones& resumen,
+                            const string& nombreArchivo) {
+    ofstream archivo(nombreArchivo);
+    if (!archivo.is_open()) return false;
+    int cantidadAlumnos = static_cast<int>(alumnos.size());
+
+    archivo << string(50, '=') << endl;
+    archivo << "     REPORTE GENERAL DE ALUMNOS" << endl;
+    archivo << string(50, '=') << endl << endl;
+
+    archivo << "Fecha de generación: " << __DATE__ << " " << __TIME__ << endl;
+    archivo << "Total de Alumnos: " << cantidadAlumnos << endl << endl;
+
+    archivo << string(50, '-') << endl;
+    archivo << "INFORMACIÓN DE ALUMNOS" << endl;
+    archivo << string(50, '-') << endl;
+
+    for (int i = 0; i < cantidadAlumnos; i++) {
+        archivo << "\nAlumno " << (i + 1) << ":" << endl;
+        archivo << "  Nombre: " << alumnos[i].nombre << endl;
+        archivo << "  Matrícula: " << alumnos[i].matricula << endl;
+        archivo << "  Calificación Parcial 1: " << fixed << setprecision(2)
+                << alumnos[i].calificacion1 << endl;
+        archivo << "  Calificación Parcial 2: " << alumnos[i].calificacion2 << endl;
+        archivo << "  Calificación Parcial 3: " << alumnos[i].calificacion3 << endl;
+        archivo << "  Calificación Final: " << alumnos[i].calificacionFinal << endl;
+        archivo << "  Estado: " << (alumnos[i].estaAprobado() ? "APROBADO" : "REPROBADO") << endl;
+    }
+
+    archivo << "\n" << string(50, '-') << endl;
+    archivo << "ESTADÍSTICAS GENERALES" << endl;
+    archivo << string(50, '-') << endl;
+
+    archivo << "Promedio General: " << fixed << setprecision(2)
+            << SistemaAdministrativo::promedioDe(resumen) << endl;
+    archivo << "Desviación Estándar: " << SistemaAdministrativo::desviacionDe(resumen) << endl;
+
+    int aprobados = static_cast<int>(resumen.aprobados);
+    int reprobados = cantidadAlumnos - aprobados;
+    archivo << "Alumnos Aprobados: " << aprobados << " ("
+            << fixed << setprecision(1)
+            << (aprobados * 100.0 / cantidadAlumnos) << "%)" << endl;
+    archivo << "Alumnos Reprobados: " << reprobados << " ("
+            << (reprobados * 100.0 / cantidadAlumnos) << "%)" << endl;
+    archivo << "Calificación Máxima: " << fixed << setprecision(2) << resumen.maximo << endl;
+    archivo << "Calificación Mínima: " << resumen.minimo << endl;
+
+    // La sección de distribución se agregó después; se escribe igual, con
+    // el flujo, para comparar los reportes completos.
+    vector<double> finales(alumnos.size());
+    for (size_t i = 0; i < alumnos.size(); i++) {
+        finales[i] = alumnos[i].calificacionFinal;
+    }
+    DistribucionCalificaciones distribucion;
+    distribucion.reconstruir(finales.data(), finales.size(), nullptr);
+
+    archivo << "\n" << string(50, '-') << endl;
+    archivo << "DISTRIBUCIÓN DE CALIFICACIONES FINALES" << endl;
+    archivo << string(50, '-') << endl;
+    archivo << "Percentil 10: " << distribucion.percentil(10) << endl;
+    archivo << "Primer Cuartil: " << distribucion.percentil(25) << endl;
+    archivo << "Mediana: " << distribucion.percentil(50) << endl;
+    archivo << "Tercer Cuartil: " << distribucion.percentil(75) << endl;
+    archivo << "Percentil 90: " << distribucion.percentil(90) << endl;
+    vector<size_t> histograma = distribucion.histograma(10);
+    for (int i = 0; i < 10; i++) {
+        archivo << "  " << i * 10.0 << " - " << (i == 9 ? 100.0 : i * 10 + 9.99) << ": " << histograma[i]
+                << " (" << setprecision(1) << (histograma[i] * 100.0 / cantidadAlumnos) << "%)" << endl
+                << setprecision(2);
+    }
+
+    archivo << "\n" << string(50, '=') << endl;
+    archivo.close();
+    return archivo.good();
+}
+
+
+static string leerArchivo(const string& nombreArchivo) {
+    ifstream archivo(nombreArchivo, ios::binary);
+    return string(istreambuf_iterator<char>(archivo), istreambuf_iterator<char>());
+}
+
+
+// La fecha del reporte es la de compilación de cada unidad (la biblioteca y
+// este programa), así que se omite al comparar.
+static string sinFecha(string contenido) {
+    size_t inicio = contenido.find("Fecha de generación: ");
+    if (inicio != string::npos) contenido.erase(inicio, contenido.find('\n', inicio) - inicio);
+    return contenido;
+}
+
+
+int main(int argc, char* argv[]) {
+    long filas = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeticiones = argc > 2 ? atoi(argv[2]) : 3;
+    int hilos = argc > 3 ? atoi(argv[3]) : max(2, static_cast<int>(thread::hardware_concurrency()));
+    const string archivo = "bench_reporte.tmp";
+    const string anterior = "bench_reporte_anterior.tmp";
+    const string nuevo = "bench_reporte_nuevo.tmp";
+    const string paralelo = "bench_reporte_paralelo.tmp";
+
+    if (!generarArchivoAlumnos(archivo, filas)) {
+        cerr << "Error: No se pudo generar " << archivo << endl;
+        return 1;
+    }
+
+    SistemaAdministrativo sistema;
+    sistema.cargarDesdeArchivo(archivo);
+
+    vector<AlumnoAnterior> alumnos;
+    alumnos.reserve(filas);
+    ifstream entrada(archivo);
+    string linea;
+    while (getline(entrada, linea)) {
+        LineaAlumno datos = analizarLinea(linea, CALIFICACION_MIN, CALIFICACION_MAX);
+        alumnos.push_back(AlumnoAnterior(string(datos.nombre), string(datos.matricula),
+                                         datos.calificacion1, datos.calificacion2, datos.calificacion3));
+    }
+    remove(archivo.c_str());
+
+    double mejorAnterior = 1e30, mejorNuevo = 1e30, mejorParalelo = 1e30;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        reportePorFlujo(alumnos, sistema.resumirFinales(), anterior);
+        mejorAnterior = min(mejorAnterior, cronometro.segundos());
+
+        cronometro.reiniciar();
+        sistema.escribirReporteGeneral(nuevo);
+        mejorNuevo = min(mejorNuevo, cronometro.segundos());
+
+        cronometro.reiniciar();
+        sistema.escribirReporteGeneral(paralelo, hilos);
+        mejorParalelo = min(mejorParalelo, cronometro.segundos());
+    }
+
+    bool iguales = sinFecha(leerArchivo(anterior)) == sinFecha(leerArchivo(nuevo)) &&
+                   leerArchivo(nuevo) == leerArchivo(paralelo);
+    long bytes = static_cast<long>(leerArchivo(nuevo).size());
+    remove(anterior.c_str());
+    remove(nuevo.c_str());
+    remove(paralelo.c_str());
+
+    cout << "alumnos: " << sistema.getCantidadAlumnos() << ", reporte: " << bytes / (1024 * 1024) << " MB" << endl;
+    cout << left << setw(22) << "metodo" << setw(14) << "tiempo (s)" << "MB/s" << endl;
+    cout << fixed << setprecision(3);
+    cout << setw(22) << "ofstream + endl" << setw(14) << mejorAnterior
+         << setprecision(1) << bytes / mejorAnterior / (1024 * 1024) << endl;
+    cout << setprecision(3) << setw(22) << "escritor con bufer" << setw(14) << mejorNuevo
+         << setprecision(1) << bytes / mejorNuevo / (1024 * 1024) << endl;
+    cout << setprecision(3) << setw(22) << "escritor, " + to_string(hilos) + " hilos" << setw(14) << mejorParalelo
+         << setprecision(1) << bytes / mejorParalelo / (1024 * 1024) << endl;
+    cout << "reportes " << (iguales ? "identicos" : "DIFERENTES") << endl;
+    return iguales ? 0 : 1;
+}
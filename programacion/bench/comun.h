@@ -0,0 +1,99 @@
+#ifndef BENCH_COMUN_H
+#define BENCH_COMUN_H
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+
+class Cronometro {
+private:
+    std::chrono::steady_clock::time_point inicio;
+
+public:
+    Cronometro() : inicio(std::chrono::steady_clock::now()) {}
+
+
+    void reiniciar() {
+        inicio = std::chrono::steady_clock::now();
+    }
+
+
+    double segundos() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    }
+};
+
+
+// Escribe un archivo nombre|matricula|c1|c2|c3 con matrículas únicas y
+// calificaciones aleatorias (reproducibles para una misma semilla). Con
+// `corrupcion` > 0 esa fracción de las líneas sale dañada, alternando entre
+// campos de menos, calificación no numérica, calificación fuera de rango,
+// nombre vacío y matrícula repetida (la de la primera línea); `corruptas`
+// recibe cuántas son.
+inline bool generarArchivoAlumnos(const std::string& nombreArchivo, long filas, unsigned semilla = 42,
+                                  double corrupcion = 0.0, long* corruptas = nullptr) {
+    static const char* nombres[] = {
+        "Juan", "María", "Carlos", "Ana", "Luis", "Sofía", "Jorge", "Lucía", "Miguel", "Valeria"
+    };
+    static const char* apellidos[] = {
+        "Pérez", "González", "Rodríguez", "Martínez", "Hernández",
+        "López", "García", "Sánchez", "Torres", "Ramírez"
+    };
+
+    std::ofstream archivo(nombreArchivo);
+    if (!archivo.is_open()) return false;
+
+    std::mt19937 generador(semilla);
+    std::mt19937 generadorDanos(semilla + 1);
+    std::uniform_int_distribution<int> indiceNombre(0, 9);
+    std::uniform_int_distribution<int> decimas(0, 1000);
+    std::uniform_real_distribution<double> azar(0.0, 1.0);
+
+    char linea[160];
+    long danadas = 0;
+    for (long i = 0; i < filas; i++) {
+        const char* nombre = nombres[indiceNombre(generador)];
+        const char* apellido1 = apellidos[indiceNombre(generador)];
+        const char* apellido2 = apellidos[indiceNombre(generador)];
+        double c1 = decimas(generador) / 10.0;
+        double c2 = decimas(generador) / 10.0;
+        double c3 = decimas(generador) / 10.0;
+
+        int n;
+        if (corrupcion > 0.0 && i > 0 && azar(generadorDanos) < corrupcion) {
+            switch (danadas++ % 5) {
+                case 0:
+                    n = std::snprintf(linea, sizeof(linea), "%s %s|A%07ld|%.1f\n", nombre, apellido1, i + 1, c1);
+                    break;
+                case 1:
+                    n = std::snprintf(linea, sizeof(linea), "%s %s|A%07ld|%.1f|diez|%.1f\n",
+                                      nombre, apellido1, i + 1, c1, c3);
+                    break;
+                case 2:
+                    n = std::snprintf(linea, sizeof(linea), "%s %s|A%07ld|%.1f|%.1f|%.1f\n",
+                                      nombre, apellido1, i + 1, c1, c2, c3 + 101.0);
+                    break;
+                case 3:
+                    n = std::snprintf(linea, sizeof(linea), "|A%07ld|%.1f|%.1f|%.1f\n", i + 1, c1, c2, c3);
+                    break;
+                default:
+                    n = std::snprintf(linea, sizeof(linea), "%s %s|A%07ld|%.1f|%.1f|%.1f\n",
+                                      nombre, apellido1, 1L, c1, c2, c3);
+                    break;
+            }
+        } else {
+            n = std::snprintf(linea, sizeof(linea), "%s %s %s|A%07ld|%.1f|%.1f|%.1f\n",
+                              nombre, apellido1, apellido2, i + 1, c1, c2, c3);
+        }
+        archivo.write(linea, n);
+    }
+    if (corruptas) *corruptas = danadas;
+    return archivo.good();
+}
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef BITACORA_H
+#define BITACORA_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "lector_alumnos.h"
+#include "instrumentacion.h"
+
+
+enum class TipoCambio : uint8_t {
+    ALTA = 1,
+    MODIFICACION = 2,
+    BAJA = 3
+};
+
+
+// Un cambio del registro. En MODIFICACION `matricula` identifica al alumno
+// antes del cambio y el resto de los campos es su nuevo estado completo.
+struct CambioBitacora {
+    TipoCambio tipo;
+    uint64_t secuencia;
+    std::string matricula;
+    std::string nombre;
+    std::string nuevaMatricula;
+    double calificacion1;
+    double calificacion2;
+    double calificacion3;
+
+    CambioBitacora() : tipo(TipoCambio::ALTA), secuencia(0),
+                       calificacion1(0), calificacion2(0), calificacion3(0) {}
+};
+
+
+// Registro de escritura anticipada (alumnos.log). Cada cambio se agrega al
+// final como un registro [longitud][suma de verificación][datos]; fsync se
+// hace por lotes. Al reproducir, un registro incompleto o corrupto marca el
+// final válido y el archivo se trunca ahí.
+class Bitacora {
+private:
+    int descriptor;
+    std::string nombreArchivo;
+    int pendientes;
+    size_t bytes;
+    size_t registros;
+    uint64_t ultima;
+    std::vector<char> bufer;
+
+    Bitacora(const Bitacora&) = delete;
+    Bitacora& operator=(const Bitacora&) = delete;
+
+
+    // Operaciones sobre el descriptor; en Windows, con las de <io.h>.
+    static int abrirDescriptor(const std::string& nombre) {
+#ifdef _WIN32
+        return _open(nombre.c_str(), _O_RDWR | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        return open(nombre.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+#endif
+    }
+
+
+    static size_t tamanoDescriptor(int fd) {
+#ifdef _WIN32
+        struct _stat64 info;
+        return _fstat64(fd, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+#else
+        struct stat info;
+        return fstat(fd, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+#endif
+    }
+
+
+    static void cerrarDescriptor(int fd) {
+#ifdef _WIN32
+        _close(fd);
+#else
+        close(fd);
+#endif
+    }
+
+
+    static bool sincronizarDescriptor(int fd) {
+#ifdef _WIN32
+        return _commit(fd) == 0;
+#else
+        return fsync(fd) == 0;
+#endif
+    }
+
+
+    static bool truncarDescriptor(int fd, size_t longitud) {
+#ifdef _WIN32
+        return _chsize_s(fd, static_cast<long long>(longitud)) == 0;
+#else
+        return ftruncate(fd, static_cast<off_t>(longitud)) == 0;
+#endif
+    }
+
+
+    // Escribe todo; una escritura interrumpida por una señal se reintenta.
+    static bool escribirDescriptor(int fd, const char* datos, size_t cantidad) {
+        while (cantidad > 0) {
+#ifdef _WIN32
+            int escritos = _write(fd, datos, static_cast<unsigned int>(cantidad));
+#else
+            ssize_t escritos = write(fd, datos, cantidad);
+#endif
+            if (escritos < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            datos += escritos;
+            cantidad -= static_cast<size_t>(escritos);
+        }
+        return true;
+    }
+
+
+    static uint32_t sumaVerificacion(const char* datos, size_t longitud) {
+        uint32_t suma = 2166136261u;
+        for (size_t i = 0; i < longitud; i++) {
+            suma ^= static_cast<unsigned char>(datos[i]);
+            suma *= 16777619u;
+        }
+        return suma;
+    }
+
+
+    template <class T>
+    void escribirValor(const T& valor) {
+        const char* p = reinterpret_cast<const char*>(&valor);
+        bufer.insert(bufer.end(), p, p + sizeof(T));
+    }
+
+
+    void escribirCadena(const std::string& cadena) {
+        escribirValor(static_cast<uint32_t>(cadena.size()));
+        bufer.insert(bufer.end(), cadena.begin(), cadena.end());
+    }
+
+
+    template <class T>
+    static bool leerValor(const char*& cursor, const char* fin, T& valor) {
+        if (static_cast<size_t>(fin - cursor) < sizeof(T)) return false;
+        std::memcpy(&valor, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+
+    static bool leerCadena(const char*& cursor, const char* fin, std::string& cadena) {
+        uint32_t longitud;
+        if (!leerValor(cursor, fin, longitud) || static_cast<size_t>(fin - cursor) < longitud) return false;
+        cadena.assign(cursor, longitud);
+        cursor += longitud;
+        return true;
+    }
+
+
+    static bool decodificar(const char* cursor, const char* fin, CambioBitacora& cambio) {
+        uint8_t tipo;
+        if (!leerValor(cursor, fin, cambio.secuencia) || !leerValor(cursor, fin, tipo)) return false;
+        if (tipo < static_cast<uint8_t>(TipoCambio::ALTA) || tipo > static_cast<uint8_t>(TipoCambio::BAJA)) {
+            return false;
+        }
+        cambio.tipo = static_cast<TipoCambio>(tipo);
+        return leerCadena(cursor, fin, cambio.matricula) &&
+               leerCadena(cursor, fin, cambio.nombre) &&
+               leerCadena(cursor, fin, cambio.nuevaMatricula) &&
+               leerValor(cursor, fin, cambio.calificacion1) &&
+               leerValor(cursor, fin, cambio.calificacion2) &&
+               leerValor(cursor, fin, cambio.calificacion3) &&
+               cursor == fin;
+    }
+
+public:
+    static const int LOTE_SINCRONIZACION = 32;
+
+
+    Bitacora() : descriptor(-1), pendientes(0), bytes(0), registros(0), ultima(0) {}
+
+
+    ~Bitacora() {
+        cerrar();
+    }
+
+
+    bool abrir(const std::string& nombre) {
+        cerrar();
+        descriptor = abrirDescriptor(nombre);
+        if (descriptor < 0) return false;
+
+        bytes = tamanoDescriptor(descriptor);
+        nombreArchivo = nombre;
+        registros = 0;
+        ultima = 0;
+        pendientes = 0;
+        return true;
+    }
+
+
+    void cerrar() {
+        if (descriptor >= 0) {
+            sincronizar();
+            cerrarDescriptor(descriptor);
+            descriptor = -1;
+        }
+    }
+
+
+    bool abierta() const {
+        return descriptor >= 0;
+    }
+
+
+    size_t tamano() const {
+        return bytes;
+    }
+
+
+    size_t cantidadRegistros() const {
+        return registros;
+    }
+
+
+    // Secuencia del último cambio leído o registrado; una instantánea con
+    // esa secuencia o mayor ya incluye toda la bitácora.
+    uint64_t ultimaSecuencia() const {
+        return ultima;
+    }
+
+
+    // Llama a aplicar(cambio) para cada registro válido en orden y devuelve
+    // cuántos registros se leyeron.
+    template <class Aplicar>
+    size_t reproducir(Aplicar aplicar) {
+        if (descriptor < 0) return 0;
+
+        ArchivoMapeado archivo;
+        if (!archivo.abrir(nombreArchivo)) return 0;
+
+        const char* inicio = archivo.datos();
+        const char* cursor = inicio;
+        const char* fin = inicio + archivo.tamano();
+        size_t leidos = 0;
+        CambioBitacora cambio;
+
+        while (cursor < fin) {
+            uint32_t longitud, suma;
+            const char* datos = cursor;
+            if (!leerValor(datos, fin, longitud) || !leerValor(datos, fin, suma) ||
+                static_cast<size_t>(fin - datos) < longitud ||
+                sumaVerificacion(datos, longitud) != suma ||
+                !decodificar(datos, datos + longitud, cambio)) {
+                break;
+            }
+            aplicar(cambio);
+            ultima = cambio.secuencia;
+            leidos++;
+            cursor = datos + longitud;
+        }
+
+        size_t validos = static_cast<size_t>(cursor - inicio);
+        if (validos < archivo.tamano()) {
+            std::cerr << "Advertencia: Se descartó el final incompleto de " << nombreArchivo << "." << std::endl;
+            if (truncarDescriptor(descriptor, validos)) {
+                sincronizarDescriptor(descriptor);
+            }
+        }
+        bytes = validos;
+        registros = leidos;
+        return leidos;
+    }
+
+
+    bool registrar(const CambioBitacora& cambio) {
+        if (descriptor < 0) return false;
+
+        bufer.assign(2 * sizeof(uint32_t), 0);
+        escribirValor(cambio.secuencia);
+        escribirValor(static_cast<uint8_t>(cambio.tipo));
+        escribirCadena(cambio.matricula);
+        escribirCadena(cambio.nombre);
+        escribirCadena(cambio.nuevaMatricula);
+        escribirValor(cambio.calificacion1);
+        escribirValor(cambio.calificacion2);
+        escribirValor(cambio.calificacion3);
+
+        uint32_t longitud = static_cast<uint32_t>(bufer.size() - 2 * sizeof(uint32_t));
+        uint32_t suma = sumaVerificacion(bufer.data() + 2 * sizeof(uint32_t), longitud);
+        std::memcpy(bufer.data(), &longitud, sizeof(uint32_t));
+        std::memcpy(bufer.data() + sizeof(uint32_t), &suma, sizeof(uint32_t));
+
+        INSTRUMENTAR_TIEMPO(ESCRITURA_DISCO);
+        INSTRUMENTAR_CONTAR(BYTES_ESCRITOS, bufer.size());
+        if (!escribirDescriptor(descriptor, bufer.data(), bufer.size())) return false;
+        bytes += bufer.size();
+        registros++;
+        ultima = cambio.secuencia;
+
+        if (++pendientes >= LOTE_SINCRONIZACION) {
+            return sincronizar();
+        }
+        return true;
+    }
+
+
+    bool sincronizar() {
+        if (descriptor < 0) return false;
+        if (pendientes == 0) return true;
+        pendientes = 0;
+        return sincronizarDescriptor(descriptor);
+    }
+
+
+    // Descarta todos los registros; se usa después de guardar una
+    // instantánea que ya los incluye.
+    bool vaciar() {
+        if (descriptor < 0) return false;
+        if (!truncarDescriptor(descriptor, 0)) return false;
+        bytes = 0;
+        registros = 0;
+        pendientes = 0;
+        return sincronizarDescriptor(descriptor);
+    }
+};
+
+#endif
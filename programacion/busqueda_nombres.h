@@ -0,0 +1,207 @@
+#ifndef BUSQUEDA_NOMBRES_H
+#define BUSQUEDA_NOMBRES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "arena_cadenas.h"
+
+
+// Letra sin acento para el segundo byte de una letra latina en UTF-8 que
+// empieza con 0xC3 (À a ÿ); 0 si no tiene equivalente.
+inline char letraSinAcento(unsigned char segundo) {
+    static const char letras[64] = {
+        'a', 'a', 'a', 'a', 'a', 'a', 0, 'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+        0, 'n', 'o', 'o', 'o', 'o', 'o', 0, 0, 'u', 'u', 'u', 'u', 'y', 0, 0,
+        'a', 'a', 'a', 'a', 'a', 'a', 0, 'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+        0, 'n', 'o', 'o', 'o', 'o', 'o', 0, 0, 'u', 'u', 'u', 'u', 'y', 0, 'y'
+    };
+    return segundo >= 0x80 && segundo < 0xC0 ? letras[segundo - 0x80] : 0;
+}
+
+
+// Forma de búsqueda de un nombre: minúsculas, sin acentos ni diéresis, la ñ
+// como n y cada palabra precedida por un espacio (" jose perez"). Los signos
+// ASCII separan palabras; los demás caracteres no ASCII se copian tal cual.
+inline void normalizarNombre(std::string_view nombre, std::string& destino) {
+    destino.clear();
+    bool separar = true;
+    for (size_t i = 0; i < nombre.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(nombre[i]);
+        char letra;
+        if (c < 0x80) {
+            bool minuscula = c >= 'a' && c <= 'z', mayuscula = c >= 'A' && c <= 'Z';
+            if (!minuscula && !mayuscula && !(c >= '0' && c <= '9')) {
+                separar = true;
+                continue;
+            }
+            letra = static_cast<char>(mayuscula ? c + ('a' - 'A') : c);
+        } else if (c == 0xC3 && i + 1 < nombre.size() &&
+                   (letra = letraSinAcento(static_cast<unsigned char>(nombre[i + 1]))) != 0) {
+            i++;
+        } else {
+            letra = nombre[i];
+        }
+
+        if (separar) {
+            destino += ' ';
+            separar = false;
+        }
+        destino += letra;
+    }
+}
+
+
+// Índice de nombres para búsquedas por prefijo de palabra y por subcadena,
+// sin distinguir mayúsculas ni acentos. Guarda la forma normalizada de cada
+// nombre y, por cada trigrama (tres bytes seguidos), las posiciones cuyos
+// nombres lo contienen. Una búsqueda toma la lista del trigrama menos
+// frecuente del patrón y confirma cada candidato con su nombre normalizado;
+// un prefijo es el patrón precedido por el espacio de inicio de palabra.
+// Los patrones de menos de tres bytes recorren los nombres normalizados.
+//
+// Las bajas no quitan a la posición de las listas: la confirmación descarta
+// las entradas viejas, y cuando éstas superan a las vigentes se rehacen las
+// listas.
+class IndiceNombres {
+private:
+    static const size_t ENTRADAS_MINIMAS_DEPURACION = 1 << 16;
+
+    std::unordered_map<uint32_t, std::vector<int>> trigramas;
+    ArenaCadenas normalizados;
+    // Nombre normalizado de cada posición; vacío si está libre.
+    std::vector<std::string_view> nombres;
+    std::string temporal;
+    size_t entradasVigentes;
+    size_t entradasViejas;
+    bool activo;
+
+
+    static uint32_t codigoTrigrama(const char* bytes) {
+        return static_cast<uint32_t>(static_cast<unsigned char>(bytes[0])) << 16 |
+               static_cast<uint32_t>(static_cast<unsigned char>(bytes[1])) << 8 |
+               static_cast<unsigned char>(bytes[2]);
+    }
+
+
+    static size_t cantidadTrigramas(std::string_view nombre) {
+        return nombre.size() >= 3 ? nombre.size() - 2 : 0;
+    }
+
+
+    void agregarTrigramas(std::string_view nombre, int posicion) {
+        for (size_t i = 0; i + 3 <= nombre.size(); i++) {
+            trigramas[codigoTrigrama(nombre.data() + i)].push_back(posicion);
+        }
+        entradasVigentes += cantidadTrigramas(nombre);
+    }
+
+
+    // Rehace las listas y la arena con sólo los nombres vigentes.
+    void depurar() {
+        trigramas.clear();
+        entradasVigentes = 0;
+        entradasViejas = 0;
+        ArenaCadenas nueva;
+        for (size_t i = 0; i < nombres.size(); i++) {
+            if (nombres[i].empty()) continue;
+            nombres[i] = nueva.guardar(nombres[i]);
+            agregarTrigramas(nombres[i], static_cast<int>(i));
+        }
+        normalizados = std::move(nueva);
+    }
+
+public:
+    IndiceNombres() : entradasVigentes(0), entradasViejas(0), activo(false) {}
+
+
+    bool estaActivo() const {
+        return activo;
+    }
+
+
+    // Vacía el índice; se reconstruye en la siguiente búsqueda.
+    void limpiar() {
+        trigramas.clear();
+        normalizados.limpiar();
+        nombres.clear();
+        entradasVigentes = 0;
+        entradasViejas = 0;
+        activo = false;
+    }
+
+
+    // Vacía y activa el índice para `posiciones` ranuras; quien llama
+    // inserta después los nombres de las ranuras ocupadas.
+    void reiniciar(size_t posiciones) {
+        limpiar();
+        nombres.assign(posiciones, std::string_view());
+        activo = true;
+    }
+
+
+    void insertar(std::string_view nombre, int posicion) {
+        if (!activo) return;
+        normalizarNombre(nombre, temporal);
+        if (temporal.empty()) temporal = " ";
+        if (static_cast<size_t>(posicion) >= nombres.size()) nombres.resize(posicion + 1);
+        nombres[posicion] = normalizados.guardar(temporal);
+        agregarTrigramas(nombres[posicion], posicion);
+    }
+
+
+    void eliminar(int posicion) {
+        if (!activo || nombres[posicion].empty()) return;
+        size_t cantidad = cantidadTrigramas(nombres[posicion]);
+        entradasVigentes -= cantidad;
+        entradasViejas += cantidad;
+        normalizados.liberar(nombres[posicion]);
+        nombres[posicion] = std::string_view();
+
+        if (entradasViejas >= ENTRADAS_MINIMAS_DEPURACION && entradasViejas > entradasVigentes) {
+            depurar();
+        }
+    }
+
+
+    // Posiciones, en orden ascendente, de los nombres que contienen `texto`
+    // o, con `prefijo`, que tienen una palabra que empieza con `texto`.
+    std::vector<int> buscar(std::string_view texto, bool prefijo) {
+        std::vector<int> posiciones;
+        normalizarNombre(texto, temporal);
+        if (temporal.empty()) return posiciones;
+        std::string_view patron(temporal);
+        if (!prefijo) patron.remove_prefix(1);
+
+        if (patron.size() < 3) {
+            for (size_t i = 0; i < nombres.size(); i++) {
+                if (!nombres[i].empty() && nombres[i].find(patron) != std::string_view::npos) {
+                    posiciones.push_back(static_cast<int>(i));
+                }
+            }
+            return posiciones;
+        }
+
+        const std::vector<int>* menor = nullptr;
+        for (size_t i = 0; i + 3 <= patron.size(); i++) {
+            auto lista = trigramas.find(codigoTrigrama(patron.data() + i));
+            if (lista == trigramas.end()) return posiciones;
+            if (!menor || lista->second.size() < menor->size()) menor = &lista->second;
+        }
+
+        posiciones = *menor;
+        std::sort(posiciones.begin(), posiciones.end());
+        posiciones.erase(std::unique(posiciones.begin(), posiciones.end()), posiciones.end());
+        posiciones.erase(std::remove_if(posiciones.begin(), posiciones.end(), [&](int posicion) {
+            return nombres[posicion].find(patron) == std::string_view::npos;
+        }), posiciones.end());
+        return posiciones;
+    }
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef COLUMNAS_CALIFICACIONES_H
+#define COLUMNAS_CALIFICACIONES_H
+
+#include <cstddef>
+#include <vector>
+
+
+// Suma, suma de cuadrados, mínimo, máximo y aprobados de una columna de
+// calificaciones.
+struct ResumenCalificaciones {
+    size_t cantidad;
+    double suma;
+    double sumaCuadrados;
+    double minimo;
+    double maximo;
+    size_t aprobados;
+};
+
+
+// Calificaciones guardadas por columnas, en las mismas posiciones que el
+// arreglo de alumnos, para que las estadísticas recorran memoria contigua
+// en lugar de estructuras Alumno con cadenas intercaladas.
+class ColumnasCalificaciones {
+private:
+    std::vector<double> parcial1;
+    std::vector<double> parcial2;
+    std::vector<double> parcial3;
+    std::vector<double> final;
+
+public:
+    void reservar(size_t elementos) {
+        parcial1.reserve(elementos);
+        parcial2.reserve(elementos);
+        parcial3.reserve(elementos);
+        final.reserve(elementos);
+    }
+
+
+    void limpiar() {
+        parcial1.clear();
+        parcial2.clear();
+        parcial3.clear();
+        final.clear();
+    }
+
+
+    void agregar(double c1, double c2, double c3, double calificacionFinal) {
+        parcial1.push_back(c1);
+        parcial2.push_back(c2);
+        parcial3.push_back(c3);
+        final.push_back(calificacionFinal);
+    }
+
+
+    void asignar(size_t posicion, double c1, double c2, double c3, double calificacionFinal) {
+        parcial1[posicion] = c1;
+        parcial2[posicion] = c2;
+        parcial3[posicion] = c3;
+        final[posicion] = calificacionFinal;
+    }
+
+
+    void mover(size_t desde, size_t hasta) {
+        parcial1[hasta] = parcial1[desde];
+        parcial2[hasta] = parcial2[desde];
+        parcial3[hasta] = parcial3[desde];
+        final[hasta] = final[desde];
+    }
+
+
+    void truncar(size_t elementos) {
+        parcial1.resize(elementos);
+        parcial2.resize(elementos);
+        parcial3.resize(elementos);
+        final.resize(elementos);
+    }
+
+
+    size_t tamano() const {
+        return final.size();
+    }
+
+
+    const double* finales() const {
+        return final.data();
+    }
+
+
+    // numero: 1, 2 o 3.
+    const double* parcial(int numero) const {
+        return numero == 1 ? parcial1.data() : numero == 2 ? parcial2.data() : parcial3.data();
+    }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef COMANDOS_LOTE_H
+#define COMANDOS_LOTE_H
+
+#include <cstddef>
+#include <string_view>
+
+
+// Comandos del modo por lotes, uno por línea con campos separados por '|':
+//
+//   alta|nombre|matricula|c1|c2|c3
+//   modificar|matricula|nombre|nuevaMatricula|c1|c2|c3   (campo vacío = sin cambio)
+//   baja|matricula
+//   consulta|matricula
+//   reporte[|archivo[|formato]]   (texto, csv, jsonl o columnar)
+//   mejores|k
+//   peores|k
+//   buscar|texto[|modo]     (contiene o prefijo; contiene por omisión)
+//   rango|columna|min|max   (final, parcial1, parcial2 o parcial3)
+//   percentil|columna|p     (p de 0 a 100)
+//   distribucion|columna[|intervalos]
+//   fusionar|archivo   (actualizaciones matricula|c1|c2|c3)
+//
+// Las líneas vacías y las que empiezan con '#' se ignoran.
+enum class TipoComando {
+    VACIO,
+    ALTA,
+    MODIFICAR,
+    BAJA,
+    CONSULTA,
+    REPORTE,
+    MEJORES,
+    PEORES,
+    BUSCAR,
+    RANGO,
+    PERCENTIL,
+    DISTRIBUCION,
+    FUSIONAR,
+    DESCONOCIDO
+};
+
+
+const size_t MAXIMO_CAMPOS_COMANDO = 7;
+
+
+// Las cadenas apuntan a la línea analizada. `campos[0]` es el nombre del
+// comando; `cantidadCampos` cuenta también los campos que no cupieron.
+struct ComandoLote {
+    TipoComando tipo;
+    std::string_view campos[MAXIMO_CAMPOS_COMANDO];
+    size_t cantidadCampos;
+};
+
+
+inline std::string_view recortarCampo(std::string_view campo) {
+    size_t inicio = campo.find_first_not_of(" \t\r");
+    if (inicio == std::string_view::npos) return std::string_view();
+    return campo.substr(inicio, campo.find_last_not_of(" \t\r") + 1 - inicio);
+}
+
+
+inline TipoComando tipoDeComando(std::string_view nombre) {
+    if (nombre == "alta") return TipoComando::ALTA;
+    if (nombre == "modificar") return TipoComando::MODIFICAR;
+    if (nombre == "baja") return TipoComando::BAJA;
+    if (nombre == "consulta") return TipoComando::CONSULTA;
+    if (nombre == "reporte") return TipoComando::REPORTE;
+    if (nombre == "mejores") return TipoComando::MEJORES;
+    if (nombre == "peores") return TipoComando::PEORES;
+    if (nombre == "buscar") return TipoComando::BUSCAR;
+    if (nombre == "rango") return TipoComando::RANGO;
+    if (nombre == "percentil") return TipoComando::PERCENTIL;
+    if (nombre == "distribucion") return TipoComando::DISTRIBUCION;
+    if (nombre == "fusionar") return TipoComando::FUSIONAR;
+    return TipoComando::DESCONOCIDO;
+}
+
+
+inline ComandoLote analizarComando(std::string_view linea) {
+    ComandoLote comando = {TipoComando::VACIO, {}, 0};
+
+    linea = recortarCampo(linea);
+    if (linea.empty() || linea[0] == '#') return comando;
+
+    size_t inicio = 0;
+    while (true) {
+        size_t separador = linea.find('|', inicio);
+        std::string_view campo = linea.substr(inicio, separador == std::string_view::npos
+                                                      ? std::string_view::npos : separador - inicio);
+        if (comando.cantidadCampos < MAXIMO_CAMPOS_COMANDO) {
+            comando.campos[comando.cantidadCampos] = recortarCampo(campo);
+        }
+        comando.cantidadCampos++;
+        if (separador == std::string_view::npos) break;
+        inicio = separador + 1;
+    }
+
+    comando.tipo = tipoDeComando(comando.campos[0]);
+    return comando;
+}
+
+
+// Columna de calificaciones del comando rango: 0 es la final y 1 a 3 los
+// parciales; -1 si no se reconoce.
+inline int columnaDeComando(std::string_view nombre) {
+    if (nombre == "final") return 0;
+    if (nombre == "parcial1") return 1;
+    if (nombre == "parcial2") return 2;
+    if (nombre == "parcial3") return 3;
+    return -1;
+}
+
+
+inline bool camposCompletos(const ComandoLote& comando) {
+    switch (comando.tipo) {
+        case TipoComando::ALTA: return comando.cantidadCampos == 6;
+        case TipoComando::MODIFICAR: return comando.cantidadCampos == 7;
+        case TipoComando::BAJA:
+        case TipoComando::CONSULTA:
+        case TipoComando::MEJORES:
+        case TipoComando::PEORES:
+        case TipoComando::FUSIONAR: return comando.cantidadCampos == 2;
+        case TipoComando::RANGO: return comando.cantidadCampos == 4;
+        case TipoComando::PERCENTIL: return comando.cantidadCampos == 3;
+        case TipoComando::DISTRIBUCION: return comando.cantidadCampos == 2 || comando.cantidadCampos == 3;
+        case TipoComando::BUSCAR: return comando.cantidadCampos == 2 || comando.cantidadCampos == 3;
+        case TipoComando::REPORTE: return comando.cantidadCampos <= 3;
+        default: return false;
+    }
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef DISTRIBUCION_CALIFICACIONES_H
+#define DISTRIBUCION_CALIFICACIONES_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// Distribución de una columna de calificaciones: cuántos alumnos hay en
+// cada centésima (0.00 a 100.00). Se llena con una sola pasada de conteo,
+// sin ordenar, y después se mantiene con cada alta, baja o modificación en
+// O(1). Los conteos acumulados, de los que salen percentiles e histogramas,
+// se guardan y sólo se recalculan (10001 sumas) tras un cambio.
+class DistribucionCalificaciones {
+private:
+    static const int CENTESIMAS_MAX = 10000;
+    static const int CUBETAS = CENTESIMAS_MAX + 1;
+
+    std::vector<uint32_t> conteos;
+    // acumulados[c]: alumnos con calificación menor o igual a c centésimas.
+    mutable std::vector<uint64_t> acumulados;
+    mutable bool acumuladosVigentes;
+    size_t cantidad;
+    bool activo;
+
+
+    static int acotar(int centesimas) {
+        return centesimas < 0 ? 0 : centesimas > CENTESIMAS_MAX ? CENTESIMAS_MAX : centesimas;
+    }
+
+
+    const std::vector<uint64_t>& conteosAcumulados() const {
+        if (!acumuladosVigentes) {
+            acumulados.resize(CUBETAS);
+            uint64_t total = 0;
+            for (int c = 0; c < CUBETAS; c++) {
+                total += conteos[c];
+                acumulados[c] = total;
+            }
+            acumuladosVigentes = true;
+        }
+        return acumulados;
+    }
+
+public:
+    DistribucionCalificaciones() : acumuladosVigentes(false), cantidad(0), activo(false) {}
+
+
+    bool estaActivo() const {
+        return activo;
+    }
+
+
+    // Vacía la distribución; se reconstruye en la siguiente consulta.
+    void limpiar() {
+        conteos.clear();
+        acumulados.clear();
+        acumuladosVigentes = false;
+        cantidad = 0;
+        activo = false;
+    }
+
+
+    void reconstruir(const double* valores, size_t n, const unsigned char* ocupadas) {
+        activo = false;
+        contar(valores, n, ocupadas);
+    }
+
+
+    // Agrega los valores a los ya contados, sin reiniciar; con sumar()
+    // permite contar partes del registro por separado y reunirlas.
+    void contar(const double* valores, size_t n, const unsigned char* ocupadas) {
+        if (!activo) {
+            conteos.assign(CUBETAS, 0);
+            cantidad = 0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (ocupadas && !ocupadas[i]) continue;
+            conteos[acotar(static_cast<int>(std::llround(valores[i] * 100.0)))]++;
+            cantidad++;
+        }
+        acumuladosVigentes = false;
+        activo = true;
+    }
+
+
+    void sumar(const DistribucionCalificaciones& otra) {
+        if (!otra.activo) return;
+        if (!activo) {
+            conteos.assign(CUBETAS, 0);
+            cantidad = 0;
+            activo = true;
+        }
+        for (int c = 0; c < CUBETAS; c++) {
+            conteos[c] += otra.conteos[c];
+        }
+        cantidad += otra.cantidad;
+        acumuladosVigentes = false;
+    }
+
+
+    void agregar(int centesimas) {
+        if (!activo) return;
+        conteos[acotar(centesimas)]++;
+        cantidad++;
+        acumuladosVigentes = false;
+    }
+
+
+    void quitar(int centesimas) {
+        if (!activo) return;
+        conteos[acotar(centesimas)]--;
+        cantidad--;
+        acumuladosVigentes = false;
+    }
+
+
+    size_t tamano() const {
+        return cantidad;
+    }
+
+
+    // Calificación en centésimas del k-ésimo alumno en orden ascendente
+    // (k empieza en 1). Quien llama garantiza 1 <= k <= tamano().
+    int kEsimo(size_t k) const {
+        const std::vector<uint64_t>& acumulado = conteosAcumulados();
+        return static_cast<int>(std::lower_bound(acumulado.begin(), acumulado.end(), k) - acumulado.begin());
+    }
+
+
+    // Percentil p (0 a 100) interpolando entre los dos valores que lo
+    // rodean, como PERCENTIL.INC de las hojas de cálculo; la mediana es el
+    // percentil 50. Requiere al menos un alumno.
+    double percentil(double p) const {
+        double rango = (cantidad - 1) * std::min(std::max(p, 0.0), 100.0) / 100.0;
+        size_t inferior = static_cast<size_t>(rango);
+        double fraccion = rango - inferior;
+        double valor = kEsimo(inferior + 1);
+        if (fraccion > 0.0) valor += fraccion * (kEsimo(inferior + 2) - valor);
+        return valor / 100.0;
+    }
+
+
+    // Alumnos por intervalo al dividir 0-100 en `intervalos` partes iguales;
+    // cada intervalo incluye su límite inferior y el último también el 100.
+    std::vector<size_t> histograma(int intervalos) const {
+        const std::vector<uint64_t>& acumulado = conteosAcumulados();
+        std::vector<size_t> resultado(intervalos);
+        uint64_t anterior = 0;
+        for (int i = 0; i < intervalos; i++) {
+            int limite = i + 1 == intervalos ? CENTESIMAS_MAX : limiteIntervalo(i + 1, intervalos) - 1;
+            resultado[i] = static_cast<size_t>(acumulado[limite] - anterior);
+            anterior = acumulado[limite];
+        }
+        return resultado;
+    }
+
+
+    // Límite inferior en centésimas del intervalo `i` de `intervalos`.
+    static int limiteIntervalo(int i, int intervalos) {
+        return static_cast<int>(static_cast<int64_t>(i) * CENTESIMAS_MAX / intervalos);
+    }
+};
+
+#endif
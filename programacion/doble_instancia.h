@@ -0,0 +1,110 @@
+#ifndef DOBLE_INSTANCIA_H
+#define DOBLE_INSTANCIA_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+
+// Dos copias de un objeto para que muchos hilos lo lean mientras uno lo
+// modifica, sin que los lectores esperen nunca a la escritura (esquema
+// "izquierda-derecha"). Los lectores usan la copia vigente; quien escribe
+// aplica el cambio a la otra, la vuelve vigente, espera a que salgan los
+// lectores que todavía estaban en la anterior y le aplica el mismo cambio.
+//
+// El costo es el doble de memoria y aplicar cada cambio dos veces, por lo
+// que el cambio debe producir el mismo efecto en ambas copias. Los lectores
+// reciben una referencia constante y sólo deben usar métodos que no
+// modifiquen el objeto, ni conservar referencias a su contenido al salir.
+template <typename T>
+class DobleInstancia {
+private:
+    static const int RANURAS_LECTORES = 64;
+
+    // Un contador por línea de caché para que los lectores de distintos
+    // hilos no compitan por la misma.
+    struct alignas(64) ContadorLectores {
+        std::atomic<long> lectores;
+
+        ContadorLectores() : lectores(0) {}
+    };
+
+    T instancias[2];
+    std::atomic<int> vigente;
+    std::atomic<int> version;
+    mutable ContadorLectores contadores[2][RANURAS_LECTORES];
+    std::mutex escritura;
+
+    DobleInstancia(const DobleInstancia&) = delete;
+    DobleInstancia& operator=(const DobleInstancia&) = delete;
+
+
+    static int ranuraDelHilo() {
+        static std::atomic<int> siguiente(0);
+        thread_local int ranura = siguiente.fetch_add(1) % RANURAS_LECTORES;
+        return ranura;
+    }
+
+
+    void esperarLectores(int cual) {
+        for (int i = 0; i < RANURAS_LECTORES; i++) {
+            while (contadores[cual][i].lectores.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+
+    // Después de cambiar la copia vigente, espera a que terminen todos los
+    // lectores que pudieron entrar a la anterior.
+    void esperarSalidaDeLectores() {
+        int anterior = version.load();
+        int siguiente = 1 - anterior;
+        esperarLectores(siguiente);
+        version.store(siguiente);
+        esperarLectores(anterior);
+    }
+
+public:
+    // La primera copia se construye copiando `inicial` y la segunda
+    // moviéndolo.
+    explicit DobleInstancia(T&& inicial)
+        : instancias{T(inicial), T(std::move(inicial))}, vigente(0), version(0) {}
+
+
+    template <typename F>
+    auto leer(F&& consulta) const -> decltype(consulta(std::declval<const T&>())) {
+        ContadorLectores& contador = contadores[version.load()][ranuraDelHilo()];
+        contador.lectores.fetch_add(1);
+        struct Salida {
+            ContadorLectores& contador;
+            ~Salida() { contador.lectores.fetch_sub(1); }
+        } salida{contador};
+        return consulta(instancias[vigente.load()]);
+    }
+
+
+    // Aplica `cambio` a ambas copias y devuelve el resultado de la primera
+    // aplicación. Las escrituras se atienden de una en una.
+    template <typename F>
+    auto escribir(F&& cambio) -> decltype(cambio(std::declval<T&>())) {
+        std::lock_guard<std::mutex> bloqueo(escritura);
+        int actual = vigente.load();
+        if constexpr (std::is_void<decltype(cambio(std::declval<T&>()))>::value) {
+            cambio(instancias[1 - actual]);
+            vigente.store(1 - actual);
+            esperarSalidaDeLectores();
+            cambio(instancias[actual]);
+        } else {
+            auto resultado = cambio(instancias[1 - actual]);
+            vigente.store(1 - actual);
+            esperarSalidaDeLectores();
+            cambio(instancias[actual]);
+            return resultado;
+        }
+    }
+};
+
+#endif
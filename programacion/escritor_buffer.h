@@ -0,0 +1,262 @@
+#ifndef ESCRITOR_BUFFER_H
+#define ESCRITOR_BUFFER_H
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "instrumentacion.h"
+
+#ifdef _WIN32
+#include <io.h>
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Número con `decimales` cifras fijas, igual que `fixed << setprecision`.
+struct Fijo {
+    double valor;
+    int decimales;
+
+    Fijo(double v, int d) : valor(v), decimales(d) {}
+};
+
+
+// Escritura secuencial de archivos con un búfer propio grande: el texto se
+// formatea directamente en el búfer y se escribe en bloques con write(2),
+// sin el estado de formato ni los vaciados de un ostream. En Windows se
+// escribe con fwrite. Abierto en memoria, el búfer crece en lugar de
+// vaciarse y el texto se lee con contenido().
+class EscritorBuffer {
+private:
+    static const size_t TAMANO_BUFER = 1 << 20;
+
+    std::vector<char> bufer;
+    size_t usados;
+    bool correcto;
+    bool enMemoria;
+    std::string archivoFinal;
+#ifdef _WIN32
+    std::FILE* archivo;
+#else
+    int fd;
+#endif
+
+    EscritorBuffer(const EscritorBuffer&) = delete;
+    EscritorBuffer& operator=(const EscritorBuffer&) = delete;
+
+
+    void escribirBloque(const char* datos, size_t cantidad) {
+        INSTRUMENTAR_TIEMPO(ESCRITURA_DISCO);
+        INSTRUMENTAR_CONTAR(BYTES_ESCRITOS, cantidad);
+#ifdef _WIN32
+        if (std::fwrite(datos, 1, cantidad, archivo) != cantidad) correcto = false;
+#else
+        while (cantidad > 0) {
+            ssize_t escritos = ::write(fd, datos, cantidad);
+            if (escritos < 0) {
+                if (errno == EINTR) continue;
+                correcto = false;
+                return;
+            }
+            datos += escritos;
+            cantidad -= static_cast<size_t>(escritos);
+        }
+#endif
+    }
+
+
+    // Lleva el archivo temporal a su disco y lo renombra sobre el final; si
+    // algo falló, lo borra y el archivo final queda como estaba.
+    void confirmarReemplazo() {
+        std::string temporal = archivoFinal + SUFIJO_TEMPORAL;
+        if (!correcto) {
+            std::remove(temporal.c_str());
+        } else {
+#ifdef _WIN32
+            // Reemplaza en un solo paso: con remove y luego rename, una
+            // falla entre ambos dejaría sólo el temporal.
+            correcto = MoveFileExA(temporal.c_str(), archivoFinal.c_str(),
+                                   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+            if (!correcto) std::remove(temporal.c_str());
+#else
+            correcto = std::rename(temporal.c_str(), archivoFinal.c_str()) == 0;
+            size_t barra = archivoFinal.rfind('/');
+            std::string directorio = barra == std::string::npos ? "." : archivoFinal.substr(0, barra + 1);
+            int descriptor = ::open(directorio.c_str(), O_RDONLY);
+            if (descriptor >= 0) {
+                ::fsync(descriptor);
+                ::close(descriptor);
+            }
+#endif
+        }
+        archivoFinal.clear();
+    }
+
+
+    // Garantiza espacio para `cantidad` bytes contiguos en el búfer.
+    char* reservar(size_t cantidad) {
+        if (usados + cantidad > bufer.size()) {
+            if (enMemoria) {
+                bufer.resize(std::max(bufer.size() * 2, usados + cantidad));
+            } else {
+                vaciar();
+            }
+        }
+        return bufer.data() + usados;
+    }
+
+public:
+    static constexpr const char* SUFIJO_TEMPORAL = ".tmp";
+
+
+#ifdef _WIN32
+    EscritorBuffer() : bufer(TAMANO_BUFER), usados(0), correcto(false), enMemoria(false), archivo(nullptr) {}
+#else
+    EscritorBuffer() : bufer(TAMANO_BUFER), usados(0), correcto(false), enMemoria(false), fd(-1) {}
+#endif
+
+
+    ~EscritorBuffer() {
+        cerrar();
+    }
+
+
+    bool abrir(const std::string& nombreArchivo) {
+        cerrar();
+        enMemoria = false;
+#ifdef _WIN32
+        archivo = std::fopen(nombreArchivo.c_str(), "wb");
+        correcto = archivo != nullptr;
+#else
+        fd = ::open(nombreArchivo.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        correcto = fd >= 0;
+#endif
+        return correcto;
+    }
+
+
+    // Descarta el contenido anterior y escribe en el búfer, sin archivo.
+    void abrirEnMemoria() {
+        cerrar();
+        enMemoria = true;
+        correcto = true;
+        usados = 0;
+    }
+
+
+    std::string_view contenido() const {
+        return std::string_view(bufer.data(), usados);
+    }
+
+
+    // Escribe en `nombreArchivo` + SUFIJO_TEMPORAL y, al cerrar sin errores,
+    // sincroniza y lo renombra sobre `nombreArchivo`: una falla a medio
+    // escribir nunca deja el archivo anterior truncado.
+    bool abrirReemplazo(const std::string& nombreArchivo) {
+        if (!abrir(nombreArchivo + SUFIJO_TEMPORAL)) return false;
+        archivoFinal = nombreArchivo;
+        return true;
+    }
+
+
+    // Escribe lo pendiente y cierra; devuelve false si alguna escritura falló.
+    bool cerrar() {
+#ifdef _WIN32
+        if (!archivo) return correcto;
+        vaciar();
+        if (!archivoFinal.empty() && correcto) {
+            INSTRUMENTAR_TIEMPO(ESCRITURA_DISCO);
+            if (std::fflush(archivo) != 0 || _commit(_fileno(archivo)) != 0) correcto = false;
+        }
+        if (std::fclose(archivo) != 0) correcto = false;
+        archivo = nullptr;
+#else
+        if (fd < 0) return correcto;
+        vaciar();
+        if (!archivoFinal.empty() && correcto) {
+            INSTRUMENTAR_TIEMPO(ESCRITURA_DISCO);
+            if (::fsync(fd) != 0) correcto = false;
+        }
+        if (::close(fd) != 0) correcto = false;
+        fd = -1;
+#endif
+        if (!archivoFinal.empty()) confirmarReemplazo();
+        return correcto;
+    }
+
+
+    void vaciar() {
+        if (enMemoria) return;
+        if (usados > 0 && correcto) escribirBloque(bufer.data(), usados);
+        usados = 0;
+    }
+
+
+    void escribirBytes(const void* datos, size_t cantidad) {
+        if (cantidad > bufer.size() && !enMemoria) {
+            vaciar();
+            if (correcto) escribirBloque(static_cast<const char*>(datos), cantidad);
+            return;
+        }
+        std::memcpy(reservar(cantidad), datos, cantidad);
+        usados += cantidad;
+    }
+
+
+    EscritorBuffer& operator<<(std::string_view texto) {
+        escribirBytes(texto.data(), texto.size());
+        return *this;
+    }
+
+
+    EscritorBuffer& operator<<(char caracter) {
+        *reservar(1) = caracter;
+        usados++;
+        return *this;
+    }
+
+
+    EscritorBuffer& operator<<(long long valor) {
+        char* destino = reservar(24);
+        usados += static_cast<size_t>(std::to_chars(destino, destino + 24, valor).ptr - destino);
+        return *this;
+    }
+
+
+    EscritorBuffer& operator<<(int valor) {
+        return *this << static_cast<long long>(valor);
+    }
+
+
+    // Sin to_chars de punto flotante se formatea con snprintf.
+    EscritorBuffer& operator<<(Fijo numero) {
+        char* destino = reservar(352);
+#if defined(__cpp_lib_to_chars)
+        std::to_chars_result resultado = std::to_chars(destino, destino + 352, numero.valor,
+                                                       std::chars_format::fixed, numero.decimales);
+        usados += static_cast<size_t>(resultado.ptr - destino);
+#else
+        int n = std::snprintf(destino, 352, "%.*f", numero.decimales, numero.valor);
+        if (n > 0) usados += static_cast<size_t>(n < 352 ? n : 351);
+#endif
+        return *this;
+    }
+};
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef ESTADISTICAS_INCREMENTALES_H
+#define ESTADISTICAS_INCREMENTALES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "columnas_calificaciones.h"
+
+
+// Estadísticas de las calificaciones finales mantenidas con cada alta, baja
+// o modificación. Las calificaciones se llevan en centésimas (0 a 10000), de
+// modo que la suma y la suma de cuadrados son enteras y exactas: agregar y
+// quitar el mismo valor no acumula error.
+//
+// Mínimo y máximo salen de un árbol de Fenwick con el conteo de alumnos por
+// calificación: agregar o quitar es O(log 10001) y consultar el k-ésimo
+// valor también, sin recorrer el registro.
+class EstadisticasIncrementales {
+private:
+    static const int CENTESIMAS_MAX = 10000;
+    static const int CUBETAS = CENTESIMAS_MAX + 1;
+
+    size_t cantidad;
+    int64_t suma;
+    int64_t sumaCuadrados;
+    size_t aprobados;
+    int umbralAprobado;
+    std::vector<int32_t> arbol;
+
+
+    void acumular(int centesimas, int32_t delta) {
+        for (int i = centesimas + 1; i <= CUBETAS; i += i & -i) {
+            arbol[i] += delta;
+        }
+    }
+
+
+    static int acotar(int centesimas) {
+        return centesimas < 0 ? 0 : centesimas > CENTESIMAS_MAX ? CENTESIMAS_MAX : centesimas;
+    }
+
+public:
+    explicit EstadisticasIncrementales(double calificacionAprobatoria)
+        : cantidad(0), suma(0), sumaCuadrados(0), aprobados(0),
+          umbralAprobado(static_cast<int>(calificacionAprobatoria * 100.0 + 0.5)),
+          arbol(CUBETAS + 1, 0) {}
+
+
+    void limpiar() {
+        cantidad = 0;
+        suma = 0;
+        sumaCuadrados = 0;
+        aprobados = 0;
+        arbol.assign(CUBETAS + 1, 0);
+    }
+
+
+    void agregar(int centesimas) {
+        centesimas = acotar(centesimas);
+        cantidad++;
+        suma += centesimas;
+        sumaCuadrados += static_cast<int64_t>(centesimas) * centesimas;
+        if (centesimas >= umbralAprobado) aprobados++;
+        acumular(centesimas, 1);
+    }
+
+
+    void quitar(int centesimas) {
+        centesimas = acotar(centesimas);
+        cantidad--;
+        suma -= centesimas;
+        sumaCuadrados -= static_cast<int64_t>(centesimas) * centesimas;
+        if (centesimas >= umbralAprobado) aprobados--;
+        acumular(centesimas, -1);
+    }
+
+
+    size_t tamano() const {
+        return cantidad;
+    }
+
+
+    // Calificación en centésimas del k-ésimo alumno en orden ascendente
+    // (k empieza en 1). Quien llama garantiza 1 <= k <= tamano().
+    int kEsimo(size_t k) const {
+        int posicion = 0;
+        int paso = 1;
+        while (paso * 2 <= CUBETAS) paso *= 2;
+        for (; paso > 0; paso /= 2) {
+            int siguiente = posicion + paso;
+            if (siguiente <= CUBETAS && static_cast<size_t>(arbol[siguiente]) < k) {
+                posicion = siguiente;
+                k -= arbol[siguiente];
+            }
+        }
+        return posicion;
+    }
+
+
+    ResumenCalificaciones resumen() const {
+        ResumenCalificaciones r = {cantidad, suma / 100.0, sumaCuadrados / 10000.0, 0.0, 0.0, aprobados};
+        if (cantidad > 0) {
+            r.minimo = kEsimo(1) / 100.0;
+            r.maximo = kEsimo(cantidad) / 100.0;
+        }
+        return r;
+    }
+};
+
+#endif
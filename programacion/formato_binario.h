@@ -0,0 +1,79 @@
+#ifndef FORMATO_BINARIO_H
+#define FORMATO_BINARIO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+
+
+// Instantánea binaria del registro (alumnos.bin):
+//
+//   CabeceraBinaria
+//   uint32_t longitudes[2 * cantidad]   nombre y matrícula de cada alumno
+//   char     cadenas[bytesCadenas]      todas las cadenas concatenadas
+//   uint16_t calificacion1[cantidad]    en centésimas (0 a 10000)
+//   uint16_t calificacion2[cantidad]
+//   uint16_t calificacion3[cantidad]
+//
+// Las calificaciones se guardan con dos decimales, la misma precisión que
+// conserva alumnos.txt. Los enteros se guardan en el orden de bytes de la
+// máquina; marcaOrden permite rechazar un archivo escrito con el orden
+// contrario.
+//
+// Versión 2 agrega `secuencia`: el número del último cambio de la bitácora
+// incluido en la instantánea. Los archivos de versión 1 se leen con
+// secuencia 0.
+const char MAGIA_BINARIA[4] = {'S', 'A', 'E', 'B'};
+const uint32_t VERSION_BINARIA = 2;
+const size_t TAMANO_CABECERA_V1 = 32;
+const uint32_t MARCA_ORDEN = 0x01020304u;
+
+
+struct CabeceraBinaria {
+    char magia[4];
+    uint32_t version;
+    uint32_t marcaOrden;
+    uint32_t reservado;
+    uint64_t cantidad;
+    uint64_t bytesCadenas;
+    uint64_t secuencia;
+};
+
+
+inline size_t tamanoCabecera(uint32_t version) {
+    return version == 1 ? TAMANO_CABECERA_V1 : sizeof(CabeceraBinaria);
+}
+
+
+inline size_t tamanoBinario(uint64_t cantidad, uint64_t bytesCadenas, uint32_t version = VERSION_BINARIA) {
+    return tamanoCabecera(version) + 2 * cantidad * sizeof(uint32_t) + bytesCadenas +
+           3 * cantidad * sizeof(uint16_t);
+}
+
+
+inline uint16_t aCentesimas(double calificacion) {
+    return static_cast<uint16_t>(std::llround(calificacion * 100.0));
+}
+
+
+// Copia la cabecera desde el inicio del archivo (completando `secuencia` en
+// los archivos de versión 1) y comprueba que el tamaño coincida.
+inline bool leerCabeceraBinaria(const char* datos, size_t tamanoArchivo, CabeceraBinaria& cabecera) {
+    if (tamanoArchivo < TAMANO_CABECERA_V1) return false;
+    std::memcpy(&cabecera, datos, TAMANO_CABECERA_V1);
+    cabecera.secuencia = 0;
+
+    if (std::memcmp(cabecera.magia, MAGIA_BINARIA, sizeof(MAGIA_BINARIA)) != 0) return false;
+    if (cabecera.marcaOrden != MARCA_ORDEN) return false;
+    if (cabecera.version < 1 || cabecera.version > VERSION_BINARIA) return false;
+    if (tamanoArchivo < tamanoCabecera(cabecera.version)) return false;
+    if (cabecera.version >= 2) {
+        std::memcpy(&cabecera, datos, sizeof(CabeceraBinaria));
+    }
+
+    if (cabecera.cantidad > tamanoArchivo || cabecera.bytesCadenas > tamanoArchivo) return false;
+    return tamanoBinario(cabecera.cantidad, cabecera.bytesCadenas, cabecera.version) == tamanoArchivo;
+}
+
+#endif
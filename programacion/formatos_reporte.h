@@ -0,0 +1,114 @@
+#ifndef FORMATOS_REPORTE_H
+#define FORMATOS_REPORTE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "escritor_buffer.h"
+
+
+// Formatos del reporte de alumnos. TEXTO es el reporte general legible;
+// los demás son para herramientas de análisis:
+//
+//   CSV       nombre,matricula,calificacion1,calificacion2,calificacion3,
+//             calificacionFinal,estado (con encabezado, comillas RFC 4180)
+//   JSONL     un objeto JSON por alumno y por línea
+//   COLUMNAR  CabeceraColumnar y luego, por columnas:
+//               uint32_t longitudesNombre[cantidad]
+//               uint32_t longitudesMatricula[cantidad]
+//               char     nombres[...]       concatenados
+//               char     matriculas[...]    concatenadas
+//               uint16_t calificacion1[cantidad]     en centésimas
+//               uint16_t calificacion2[cantidad]
+//               uint16_t calificacion3[cantidad]
+//               uint16_t calificacionFinal[cantidad]
+//               uint8_t  aprobado[cantidad]
+//             Los enteros van en el orden de bytes de la máquina, como en
+//             alumnos.bin.
+enum class FormatoReporte {
+    TEXTO,
+    CSV,
+    JSONL,
+    COLUMNAR
+};
+
+
+const char MAGIA_COLUMNAR[4] = {'S', 'A', 'E', 'C'};
+const uint32_t VERSION_COLUMNAR = 1;
+
+
+struct CabeceraColumnar {
+    char magia[4];
+    uint32_t version;
+    uint32_t marcaOrden;
+    uint32_t reservado;
+    uint64_t cantidad;
+    uint64_t bytesNombres;
+    uint64_t bytesMatriculas;
+};
+
+
+inline bool formatoDesdeNombre(std::string_view nombre, FormatoReporte& formato) {
+    if (nombre == "texto") formato = FormatoReporte::TEXTO;
+    else if (nombre == "csv") formato = FormatoReporte::CSV;
+    else if (nombre == "jsonl") formato = FormatoReporte::JSONL;
+    else if (nombre == "columnar") formato = FormatoReporte::COLUMNAR;
+    else return false;
+    return true;
+}
+
+
+inline const char* archivoReportePorOmision(FormatoReporte formato) {
+    switch (formato) {
+        case FormatoReporte::CSV: return "reporte.csv";
+        case FormatoReporte::JSONL: return "reporte.jsonl";
+        case FormatoReporte::COLUMNAR: return "reporte.col";
+        default: return "reporte.txt";
+    }
+}
+
+
+// Escribe un campo CSV; sólo lo entrecomilla si contiene comas, comillas o
+// saltos de línea.
+inline void escribirCampoCsv(EscritorBuffer& salida, std::string_view campo) {
+    if (campo.find_first_of(",\"\r\n") == std::string_view::npos) {
+        salida << campo;
+        return;
+    }
+    salida << '"';
+    size_t inicio = 0;
+    for (size_t i = 0; i < campo.size(); i++) {
+        if (campo[i] == '"') {
+            salida << campo.substr(inicio, i + 1 - inicio) << '"';
+            inicio = i + 1;
+        }
+    }
+    salida << campo.substr(inicio) << '"';
+}
+
+
+// Escribe una cadena JSON entre comillas; el UTF-8 se copia tal cual.
+inline void escribirCadenaJson(EscritorBuffer& salida, std::string_view cadena) {
+    static const char hexadecimal[] = "0123456789abcdef";
+    salida << '"';
+    size_t inicio = 0;
+    for (size_t i = 0; i < cadena.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(cadena[i]);
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+
+        salida << cadena.substr(inicio, i - inicio);
+        switch (c) {
+            case '"': salida << "\\\""; break;
+            case '\\': salida << "\\\\"; break;
+            case '\n': salida << "\\n"; break;
+            case '\r': salida << "\\r"; break;
+            case '\t': salida << "\\t"; break;
+            default: salida << "\\u00" << hexadecimal[c >> 4] << hexadecimal[c & 0xF]; break;
+        }
+        inicio = i + 1;
+    }
+    salida << cadena.substr(inicio) << '"';
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef GUARDADO_SEGUNDO_PLANO_H
+#define GUARDADO_SEGUNDO_PLANO_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "escritor_buffer.h"
+
+
+// Lo que terminó de escribirse desde la consulta anterior.
+struct EstadoGuardado {
+    bool guardada;
+    uint64_t secuencia;
+    bool fallo;
+};
+
+
+// Escribe instantáneas en un hilo propio para que quien edita no espere al
+// disco. Cada instantánea es una copia inmutable de los bytes a guardar con
+// la secuencia del último cambio que incluye; si llegan varias mientras se
+// escribe otra, sólo se escribe la más reciente. Cada escritura reemplaza
+// el archivo de forma atómica (EscritorBuffer::abrirReemplazo). Al destruirse
+// termina de escribir la instantánea pendiente.
+class GuardadoSegundoPlano {
+private:
+    struct Instantanea {
+        std::string archivo;
+        std::vector<char> datos;
+        uint64_t secuencia;
+    };
+
+    std::mutex candado;
+    std::condition_variable aviso;
+    Instantanea pendiente;
+    bool hayPendiente;
+    bool escribiendo;
+    bool detenido;
+    EstadoGuardado estado;
+    std::thread hilo;
+
+    GuardadoSegundoPlano(const GuardadoSegundoPlano&) = delete;
+    GuardadoSegundoPlano& operator=(const GuardadoSegundoPlano&) = delete;
+
+
+    static bool escribir(const Instantanea& instantanea) {
+        EscritorBuffer archivo;
+        if (!archivo.abrirReemplazo(instantanea.archivo)) return false;
+        archivo.escribirBytes(instantanea.datos.data(), instantanea.datos.size());
+        return archivo.cerrar();
+    }
+
+
+    void atender() {
+        std::unique_lock<std::mutex> bloqueo(candado);
+        while (true) {
+            aviso.wait(bloqueo, [this] { return detenido || hayPendiente; });
+            if (!hayPendiente) return;
+
+            Instantanea actual = std::move(pendiente);
+            hayPendiente = false;
+            escribiendo = true;
+            bloqueo.unlock();
+            bool correcto = escribir(actual);
+            bloqueo.lock();
+            escribiendo = false;
+
+            if (correcto) {
+                estado.guardada = true;
+                estado.secuencia = actual.secuencia;
+            } else {
+                estado.fallo = true;
+            }
+            aviso.notify_all();
+        }
+    }
+
+public:
+    GuardadoSegundoPlano()
+        : hayPendiente(false), escribiendo(false), detenido(false), estado{false, 0, false},
+          hilo(&GuardadoSegundoPlano::atender, this) {}
+
+
+    ~GuardadoSegundoPlano() {
+        {
+            std::lock_guard<std::mutex> bloqueo(candado);
+            detenido = true;
+        }
+        aviso.notify_all();
+        hilo.join();
+    }
+
+
+    // Reemplaza a la instantánea pendiente si todavía no empezaba a escribirse.
+    void enviar(const std::string& archivo, std::vector<char> datos, uint64_t secuencia) {
+        {
+            std::lock_guard<std::mutex> bloqueo(candado);
+            pendiente.archivo = archivo;
+            pendiente.datos = std::move(datos);
+            pendiente.secuencia = secuencia;
+            hayPendiente = true;
+        }
+        aviso.notify_all();
+    }
+
+
+    bool ocupado() {
+        std::lock_guard<std::mutex> bloqueo(candado);
+        return hayPendiente || escribiendo;
+    }
+
+
+    // Espera a que no quede nada por escribir.
+    void esperar() {
+        std::unique_lock<std::mutex> bloqueo(candado);
+        aviso.wait(bloqueo, [this] { return !hayPendiente && !escribiendo; });
+    }
+
+
+    EstadoGuardado consultar() {
+        std::lock_guard<std::mutex> bloqueo(candado);
+        EstadoGuardado resultado = estado;
+        estado = EstadoGuardado{false, 0, false};
+        return resultado;
+    }
+};
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef INDICE_MATRICULAS_H
+#define INDICE_MATRICULAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// Índice hash de direccionamiento abierto (sondeo lineal) que asocia cada
+// matrícula con su posición en el arreglo de alumnos. Las celdas sólo guardan
+// el hash y la posición; para comparar claves se usa una función que devuelve
+// la matrícula almacenada en una posición, así el índice no duplica cadenas.
+class IndiceMatriculas {
+private:
+    struct Celda {
+        uint32_t hash;
+        int posicion;
+    };
+
+    static const int VACIA = -1;
+    static const size_t CELDAS_INICIALES = 16;
+
+    std::vector<Celda> celdas;
+    size_t ocupadas;
+    size_t mascara;
+
+
+    void reconstruir(size_t nuevasCeldas) {
+        std::vector<Celda> anteriores;
+        anteriores.swap(celdas);
+        celdas.assign(nuevasCeldas, Celda{0, VACIA});
+        mascara = nuevasCeldas - 1;
+
+        for (size_t i = 0; i < anteriores.size(); i++) {
+            if (anteriores[i].posicion != VACIA) {
+                colocar(anteriores[i].hash, anteriores[i].posicion);
+            }
+        }
+    }
+
+
+    void colocar(uint32_t hash, int posicion) {
+        size_t i = hash & mascara;
+        while (celdas[i].posicion != VACIA) {
+            i = (i + 1) & mascara;
+        }
+        celdas[i].hash = hash;
+        celdas[i].posicion = posicion;
+    }
+
+
+    // Borrado por desplazamiento hacia atrás: evita dejar lápidas que
+    // alarguen las cadenas de sondeo tras muchas eliminaciones.
+    void vaciarCelda(size_t i) {
+        size_t j = i;
+        while (true) {
+            celdas[i].posicion = VACIA;
+            size_t ideal;
+            do {
+                j = (j + 1) & mascara;
+                if (celdas[j].posicion == VACIA) return;
+                ideal = celdas[j].hash & mascara;
+            } while (i <= j ? (i < ideal && ideal <= j) : (i < ideal || ideal <= j));
+            celdas[i] = celdas[j];
+            i = j;
+        }
+    }
+
+
+    static size_t celdasPara(size_t elementos) {
+        size_t n = CELDAS_INICIALES;
+        while (n / 2 < elementos) {
+            n *= 2;
+        }
+        return n;
+    }
+
+public:
+    IndiceMatriculas() : ocupadas(0), mascara(CELDAS_INICIALES - 1) {
+        celdas.assign(CELDAS_INICIALES, Celda{0, VACIA});
+    }
+
+
+    static uint32_t calcularHash(const char* datos, size_t longitud) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < longitud; i++) {
+            hash ^= static_cast<unsigned char>(datos[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+
+    static uint32_t calcularHash(std::string_view clave) {
+        return calcularHash(clave.data(), clave.size());
+    }
+
+
+    void reservar(size_t elementos) {
+        size_t necesarias = celdasPara(elementos);
+        if (necesarias > celdas.size()) {
+            reconstruir(necesarias);
+        }
+    }
+
+
+    void limpiar() {
+        celdas.assign(CELDAS_INICIALES, Celda{0, VACIA});
+        mascara = CELDAS_INICIALES - 1;
+        ocupadas = 0;
+    }
+
+
+    size_t tamano() const {
+        return ocupadas;
+    }
+
+
+    // claveEn(posicion) debe devolver la matrícula guardada en esa posición.
+    template <class ClaveEn>
+    int buscar(std::string_view clave, ClaveEn claveEn) const {
+        uint32_t hash = calcularHash(clave);
+        size_t i = hash & mascara;
+        while (celdas[i].posicion != VACIA) {
+            if (celdas[i].hash == hash && claveEn(celdas[i].posicion) == clave) {
+                return celdas[i].posicion;
+            }
+            i = (i + 1) & mascara;
+        }
+        return -1;
+    }
+
+
+    // No comprueba duplicados: quien llama ya verificó con buscar().
+    void insertar(std::string_view clave, int posicion) {
+        if ((ocupadas + 1) * 2 > celdas.size()) {
+            reconstruir(celdas.size() * 2);
+        }
+        colocar(calcularHash(clave), posicion);
+        ocupadas++;
+    }
+
+
+    bool eliminar(std::string_view clave, int posicion) {
+        uint32_t hash = calcularHash(clave);
+        size_t i = hash & mascara;
+        while (celdas[i].posicion != VACIA) {
+            if (celdas[i].posicion == posicion && celdas[i].hash == hash) {
+                vaciarCelda(i);
+                ocupadas--;
+                return true;
+            }
+            i = (i + 1) & mascara;
+        }
+        return false;
+    }
+
+
+    // Actualiza la posición de una matrícula cuyo alumno se movió en el arreglo.
+    bool reubicar(std::string_view clave, int anterior, int nueva) {
+        uint32_t hash = calcularHash(clave);
+        size_t i = hash & mascara;
+        while (celdas[i].posicion != VACIA) {
+            if (celdas[i].posicion == anterior && celdas[i].hash == hash) {
+                celdas[i].posicion = nueva;
+                return true;
+            }
+            i = (i + 1) & mascara;
+        }
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef INDICE_RANGOS_H
+#define INDICE_RANGOS_H
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+
+// Columnas con índice de rangos: la calificación final y los tres parciales.
+const int COLUMNAS_RANGO = 4;
+
+
+// Índice de una columna de calificaciones para consultas por rango. Hay una
+// cubeta por centésima (0.00 a 100.00) con las posiciones que tienen ese
+// valor, así que una consulta recorre sólo las cubetas del rango y copia
+// sus k posiciones; altas y bajas cuestan O(1). Se construye la primera vez
+// que se consulta y desde entonces se mantiene con cada cambio; una columna
+// que nunca se consulta no cuesta nada.
+class IndiceRangos {
+private:
+    static const int CUBETAS = 10001;
+
+    std::vector<std::vector<int>> cubetas;
+    // Lugar de cada posición dentro de su cubeta, para quitarla sin buscar.
+    std::vector<int> lugares;
+    bool activo;
+
+
+    static int cubetaDe(int centesimas) {
+        return centesimas < 0 ? 0 : centesimas >= CUBETAS ? CUBETAS - 1 : centesimas;
+    }
+
+public:
+    IndiceRangos() : activo(false) {}
+
+
+    bool estaActivo() const {
+        return activo;
+    }
+
+
+    // Vacía el índice; se reconstruye en la siguiente consulta.
+    void limpiar() {
+        cubetas.clear();
+        lugares.clear();
+        activo = false;
+    }
+
+
+    void reconstruir(const double* valores, size_t n, const unsigned char* ocupadas) {
+        cubetas.assign(CUBETAS, std::vector<int>());
+        lugares.assign(n, -1);
+        activo = true;
+        for (size_t i = 0; i < n; i++) {
+            if (ocupadas[i]) insertar(static_cast<int>(std::llround(valores[i] * 100.0)), static_cast<int>(i));
+        }
+    }
+
+
+    void insertar(int centesimas, int posicion) {
+        if (!activo) return;
+        std::vector<int>& cubeta = cubetas[cubetaDe(centesimas)];
+        if (static_cast<size_t>(posicion) >= lugares.size()) lugares.resize(posicion + 1, -1);
+        lugares[posicion] = static_cast<int>(cubeta.size());
+        cubeta.push_back(posicion);
+    }
+
+
+    // El lugar de la posición quitada lo ocupa la última de la cubeta.
+    void eliminar(int centesimas, int posicion) {
+        if (!activo) return;
+        std::vector<int>& cubeta = cubetas[cubetaDe(centesimas)];
+        int lugar = lugares[posicion];
+        int ultima = cubeta.back();
+        cubeta[lugar] = ultima;
+        lugares[ultima] = lugar;
+        cubeta.pop_back();
+        lugares[posicion] = -1;
+    }
+
+
+    // Posiciones con calificación en [desde, hasta] (centésimas), de menor
+    // a mayor calificación; los empates no guardan un orden particular.
+    std::vector<int> rango(int desde, int hasta) const {
+        std::vector<int> posiciones;
+        if (desde > hasta) return posiciones;
+        int primera = cubetaDe(desde), ultima = cubetaDe(hasta);
+        size_t cantidad = 0;
+        for (int c = primera; c <= ultima; c++) {
+            cantidad += cubetas[c].size();
+        }
+        posiciones.reserve(cantidad);
+        for (int c = primera; c <= ultima; c++) {
+            posiciones.insert(posiciones.end(), cubetas[c].begin(), cubetas[c].end());
+        }
+        return posiciones;
+    }
+};
+
+#endif
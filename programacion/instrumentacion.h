@@ -0,0 +1,176 @@
+#ifndef INSTRUMENTACION_H
+#define INSTRUMENTACION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+
+// Contadores y temporizadores de las rutas costosas del registro (análisis
+// de líneas, búsqueda de duplicados, crecimiento del arreglo y escritura a
+// disco). Sólo se actualizan al compilar con -DSISTEMA_INSTRUMENTACION; sin
+// la macro, INSTRUMENTAR_CONTAR e INSTRUMENTAR_TIEMPO no generan código ni
+// evalúan sus argumentos. La biblioteca y el programa que la usa deben
+// compilarse con la misma opción.
+
+enum class Contador {
+    LINEAS_ANALIZADAS,
+    LINEAS_RECHAZADAS,
+    BUSQUEDAS,
+    COMPARACIONES,
+    REDIMENSIONAMIENTOS,
+    BYTES_LEIDOS,
+    BYTES_ESCRITOS,
+    TOTAL
+};
+
+
+enum class Temporizador {
+    CARGA,
+    ANALISIS,
+    DUPLICADOS,
+    REDIMENSIONAR,
+    GUARDADO,
+    REPORTE,
+    ESCRITURA_DISCO,
+    TOTAL
+};
+
+
+#ifdef SISTEMA_INSTRUMENTACION
+const bool INSTRUMENTACION_HABILITADA = true;
+#else
+const bool INSTRUMENTACION_HABILITADA = false;
+#endif
+
+
+// Los valores son globales al proceso y se suman con operaciones atómicas
+// relajadas, así que pueden actualizarse desde los hilos de carga y desde
+// los lectores de SistemaConcurrente.
+class Instrumentacion {
+private:
+    static const int CONTADORES = static_cast<int>(Contador::TOTAL);
+    static const int TEMPORIZADORES = static_cast<int>(Temporizador::TOTAL);
+
+    struct Valores {
+        std::atomic<uint64_t> contadores[CONTADORES];
+        std::atomic<uint64_t> llamadas[TEMPORIZADORES];
+        std::atomic<uint64_t> nanosegundos[TEMPORIZADORES];
+
+        Valores() {
+            for (int i = 0; i < CONTADORES; i++) contadores[i] = 0;
+            for (int i = 0; i < TEMPORIZADORES; i++) llamadas[i] = nanosegundos[i] = 0;
+        }
+    };
+
+
+    static Valores& valores() {
+        static Valores instancia;
+        return instancia;
+    }
+
+public:
+    static void sumar(Contador contador, uint64_t cantidad) {
+        valores().contadores[static_cast<int>(contador)].fetch_add(cantidad, std::memory_order_relaxed);
+    }
+
+
+    static void sumarTiempo(Temporizador temporizador, uint64_t nanosegundos) {
+        Valores& v = valores();
+        v.llamadas[static_cast<int>(temporizador)].fetch_add(1, std::memory_order_relaxed);
+        v.nanosegundos[static_cast<int>(temporizador)].fetch_add(nanosegundos, std::memory_order_relaxed);
+    }
+
+
+    static uint64_t valor(Contador contador) {
+        return valores().contadores[static_cast<int>(contador)].load(std::memory_order_relaxed);
+    }
+
+
+    static uint64_t llamadas(Temporizador temporizador) {
+        return valores().llamadas[static_cast<int>(temporizador)].load(std::memory_order_relaxed);
+    }
+
+
+    static double milisegundos(Temporizador temporizador) {
+        return valores().nanosegundos[static_cast<int>(temporizador)].load(std::memory_order_relaxed) / 1e6;
+    }
+
+
+    static void reiniciar() {
+        Valores& v = valores();
+        for (int i = 0; i < CONTADORES; i++) v.contadores[i] = 0;
+        for (int i = 0; i < TEMPORIZADORES; i++) v.llamadas[i] = v.nanosegundos[i] = 0;
+    }
+
+
+    static const char* clave(Contador contador) {
+        static const char* const claves[CONTADORES] = {
+            "lineas_analizadas", "lineas_rechazadas", "busquedas", "comparaciones",
+            "redimensionamientos", "bytes_leidos", "bytes_escritos"
+        };
+        return claves[static_cast<int>(contador)];
+    }
+
+
+    static const char* clave(Temporizador temporizador) {
+        static const char* const claves[TEMPORIZADORES] = {
+            "carga", "analisis", "duplicados", "redimensionar", "guardado", "reporte", "escritura_disco"
+        };
+        return claves[static_cast<int>(temporizador)];
+    }
+
+
+    // Una línea por valor, campos separados por '|':
+    //   instrumentacion|contador|<clave>|<valor>
+    //   instrumentacion|tiempo|<clave>|<llamadas>|<milisegundos>
+    static void volcar(std::ostream& salida) {
+        for (int i = 0; i < CONTADORES; i++) {
+            Contador contador = static_cast<Contador>(i);
+            salida << "instrumentacion|contador|" << clave(contador) << '|' << valor(contador) << '\n';
+        }
+        for (int i = 0; i < TEMPORIZADORES; i++) {
+            Temporizador temporizador = static_cast<Temporizador>(i);
+            salida << "instrumentacion|tiempo|" << clave(temporizador) << '|' << llamadas(temporizador)
+                   << '|' << milisegundos(temporizador) << '\n';
+        }
+        salida.flush();
+    }
+};
+
+
+// Suma al temporizador el tiempo transcurrido hasta el final del ámbito.
+class MedicionTiempo {
+private:
+    Temporizador temporizador;
+    std::chrono::steady_clock::time_point inicio;
+
+    MedicionTiempo(const MedicionTiempo&) = delete;
+    MedicionTiempo& operator=(const MedicionTiempo&) = delete;
+
+public:
+    explicit MedicionTiempo(Temporizador t) : temporizador(t), inicio(std::chrono::steady_clock::now()) {}
+
+
+    ~MedicionTiempo() {
+        auto transcurrido = std::chrono::steady_clock::now() - inicio;
+        Instrumentacion::sumarTiempo(temporizador, static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(transcurrido).count()));
+    }
+};
+
+
+#ifdef SISTEMA_INSTRUMENTACION
+#define INSTRUMENTAR_UNIR_(a, b) a##b
+#define INSTRUMENTAR_UNIR(a, b) INSTRUMENTAR_UNIR_(a, b)
+#define INSTRUMENTAR_CONTAR(contador, cantidad) \
+    Instrumentacion::sumar(Contador::contador, static_cast<uint64_t>(cantidad))
+#define INSTRUMENTAR_TIEMPO(temporizador) \
+    MedicionTiempo INSTRUMENTAR_UNIR(medicionTiempo, __LINE__)(Temporizador::temporizador)
+#else
+#define INSTRUMENTAR_CONTAR(contador, cantidad) ((void)0)
+#define INSTRUMENTAR_TIEMPO(temporizador) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef LECTOR_ALUMNOS_H
+#define LECTOR_ALUMNOS_H
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+// Contenido completo de un archivo de sólo lectura. En sistemas POSIX se
+// proyecta en memoria con mmap; si no es posible (archivo vacío, tubería,
+// Windows) se lee de una vez a un búfer propio.
+class ArchivoMapeado {
+private:
+    const char* contenido;
+    size_t longitud;
+    bool mapeado;
+    std::vector<char> bufer;
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+
+    void cerrar() {
+#ifndef _WIN32
+        if (mapeado) {
+            munmap(const_cast<char*>(contenido), longitud);
+        }
+#endif
+        contenido = nullptr;
+        longitud = 0;
+        mapeado = false;
+        bufer.clear();
+    }
+
+public:
+    ArchivoMapeado() : contenido(nullptr), longitud(0), mapeado(false) {}
+
+
+    ~ArchivoMapeado() {
+        cerrar();
+    }
+
+
+    bool abrir(const std::string& nombreArchivo) {
+        cerrar();
+#ifdef _WIN32
+        std::ifstream archivo(nombreArchivo, std::ios::binary);
+        if (!archivo.is_open()) return false;
+        bufer.assign(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+        contenido = bufer.data();
+        longitud = bufer.size();
+        return true;
+#else
+        int fd = open(nombreArchivo.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info;
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            void* region = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (region != MAP_FAILED) {
+                madvise(region, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+                contenido = static_cast<const char*>(region);
+                longitud = static_cast<size_t>(info.st_size);
+                mapeado = true;
+                close(fd);
+                return true;
+            }
+        }
+
+        char bloque[65536];
+        ssize_t leidos;
+        while ((leidos = read(fd, bloque, sizeof(bloque))) > 0) {
+            bufer.insert(bufer.end(), bloque, bloque + leidos);
+        }
+        close(fd);
+        if (leidos < 0) {
+            bufer.clear();
+            return false;
+        }
+        contenido = bufer.data();
+        longitud = bufer.size();
+        return true;
+#endif
+    }
+
+
+    const char* datos() const {
+        return contenido;
+    }
+
+
+    size_t tamano() const {
+        return longitud;
+    }
+};
+
+
+enum class EstadoLinea {
+    VACIA,
+    VALIDA,
+    FORMATO_INVALIDO,
+    CALIFICACIONES_INVALIDAS,
+    NUMEROS_FUERA_DE_RANGO,
+    CALIFICACIONES_FUERA_DE_RANGO,
+    CAMPOS_VACIOS
+};
+
+
+// Resultado de analizar una línea nombre|matricula|c1|c2|c3. Las cadenas
+// apuntan al búfer de origen; no se copia nada hasta insertar el alumno.
+struct LineaAlumno {
+    EstadoLinea estado;
+    std::string_view nombre;
+    std::string_view matricula;
+    double calificacion1;
+    double calificacion2;
+    double calificacion3;
+};
+
+
+inline const char* motivoLinea(EstadoLinea estado) {
+    switch (estado) {
+        case EstadoLinea::FORMATO_INVALIDO: return "formato inválido";
+        case EstadoLinea::CALIFICACIONES_INVALIDAS: return "calificaciones inválidas";
+        case EstadoLinea::NUMEROS_FUERA_DE_RANGO: return "números fuera de rango";
+        case EstadoLinea::CALIFICACIONES_FUERA_DE_RANGO: return "calificaciones fuera de rango";
+        case EstadoLinea::CAMPOS_VACIOS: return "nombre o matrícula vacíos";
+        default: return "";
+    }
+}
+
+
+// Convierte un campo numérico con las mismas reglas que stod: ignora
+// espacios iniciales y texto después del número, y acepta hexadecimal con
+// prefijo 0x. Devuelve VALIDA o el error que stod habría señalado con una
+// excepción.
+inline EstadoLinea convertirCalificacion(std::string_view campo, double& valor) {
+    size_t i = 0;
+    while (i < campo.size() && (campo[i] == ' ' || (campo[i] >= '\t' && campo[i] <= '\r'))) {
+        i++;
+    }
+    if (i + 1 < campo.size() && campo[i] == '+' &&
+        (campo[i + 1] == '.' || (campo[i + 1] >= '0' && campo[i + 1] <= '9'))) {
+        i++;
+    }
+    const char* inicio = campo.data() + i;
+    const char* fin = campo.data() + campo.size();
+
+#if defined(__cpp_lib_to_chars)
+    // from_chars no reconoce el prefijo 0x: el número se lee sin él (ni el
+    // signo) en formato hexadecimal.
+    auto esHexadecimal = [fin](const char* p) {
+        return p < fin && ((*p >= '0' && *p <= '9') || (*p >= 'a' && *p <= 'f') || (*p >= 'A' && *p <= 'F'));
+    };
+    const char* numero = inicio;
+    bool negativo = numero < fin && *numero == '-';
+    if (negativo) numero++;
+    bool hexadecimal = fin - numero > 2 && numero[0] == '0' && (numero[1] == 'x' || numero[1] == 'X') &&
+                       (esHexadecimal(numero + 2) || (numero[2] == '.' && esHexadecimal(numero + 3)));
+
+    std::from_chars_result resultado = hexadecimal
+        ? std::from_chars(numero + 2, fin, valor, std::chars_format::hex)
+        : std::from_chars(inicio, fin, valor);
+    if (hexadecimal && negativo) valor = -valor;
+    if (resultado.ec == std::errc::invalid_argument) return EstadoLinea::CALIFICACIONES_INVALIDAS;
+    if (resultado.ec == std::errc::result_out_of_range) return EstadoLinea::NUMEROS_FUERA_DE_RANGO;
+    return EstadoLinea::VALIDA;
+#else
+    char copia[64];
+    size_t n = static_cast<size_t>(fin - inicio);
+    if (n >= sizeof(copia)) n = sizeof(copia) - 1;
+    std::memcpy(copia, inicio, n);
+    copia[n] = '\0';
+
+    char* finNumero;
+    errno = 0;
+    valor = std::strtod(copia, &finNumero);
+    if (finNumero == copia) return EstadoLinea::CALIFICACIONES_INVALIDAS;
+    if (errno == ERANGE) return EstadoLinea::NUMEROS_FUERA_DE_RANGO;
+    return EstadoLinea::VALIDA;
+#endif
+}
+
+
+inline LineaAlumno analizarLinea(std::string_view linea, double minimo, double maximo) {
+    LineaAlumno resultado = {EstadoLinea::VACIA, {}, {}, 0, 0, 0};
+
+    size_t inicio = linea.find_first_not_of(" \t\n\r");
+    if (inicio == std::string_view::npos) return resultado;
+    linea = linea.substr(inicio, linea.find_last_not_of(" \t\n\r") + 1 - inicio);
+
+    resultado.estado = EstadoLinea::FORMATO_INVALIDO;
+    size_t pos1 = linea.find('|');
+    if (pos1 == std::string_view::npos) return resultado;
+    size_t pos2 = linea.find('|', pos1 + 1);
+    if (pos2 == std::string_view::npos) return resultado;
+    size_t pos3 = linea.find('|', pos2 + 1);
+    if (pos3 == std::string_view::npos) return resultado;
+
+    EstadoLinea estado = convertirCalificacion(linea.substr(pos2 + 1, pos3 - pos2 - 1), resultado.calificacion1);
+    if (estado != EstadoLinea::VALIDA) {
+        resultado.estado = estado;
+        return resultado;
+    }
+
+    size_t pos4 = linea.find('|', pos3 + 1);
+    if (pos4 == std::string_view::npos) return resultado;
+
+    estado = convertirCalificacion(linea.substr(pos3 + 1, pos4 - pos3 - 1), resultado.calificacion2);
+    if (estado == EstadoLinea::VALIDA) {
+        estado = convertirCalificacion(linea.substr(pos4 + 1), resultado.calificacion3);
+    }
+    if (estado != EstadoLinea::VALIDA) {
+        resultado.estado = estado;
+        return resultado;
+    }
+
+    if (resultado.calificacion1 < minimo || resultado.calificacion1 > maximo ||
+        resultado.calificacion2 < minimo || resultado.calificacion2 > maximo ||
+        resultado.calificacion3 < minimo || resultado.calificacion3 > maximo) {
+        resultado.estado = EstadoLinea::CALIFICACIONES_FUERA_DE_RANGO;
+        return resultado;
+    }
+
+    resultado.nombre = linea.substr(0, pos1);
+    resultado.matricula = linea.substr(pos1 + 1, pos2 - pos1 - 1);
+    if (resultado.nombre.empty() || resultado.matricula.empty()) {
+        resultado.estado = EstadoLinea::CAMPOS_VACIOS;
+        return resultado;
+    }
+
+    resultado.estado = EstadoLinea::VALIDA;
+    return resultado;
+}
+
+
+// Línea de un archivo de actualizaciones. La forma matricula|c1|c2|c3 sólo
+// trae calificaciones y deja `nombre` vacío; una línea con el formato de
+// alumnos.txt (nombre|matricula|c1|c2|c3) trae también el nombre.
+inline LineaAlumno analizarActualizacion(std::string_view linea, double minimo, double maximo) {
+    size_t inicio = linea.find_first_not_of(" \t\n\r");
+    if (inicio == std::string_view::npos) return LineaAlumno{EstadoLinea::VACIA, {}, {}, 0, 0, 0};
+    linea = linea.substr(inicio, linea.find_last_not_of(" \t\n\r") + 1 - inicio);
+
+    size_t pos1 = linea.find('|');
+    size_t pos2 = pos1 == std::string_view::npos ? pos1 : linea.find('|', pos1 + 1);
+    size_t pos3 = pos2 == std::string_view::npos ? pos2 : linea.find('|', pos2 + 1);
+    if (pos3 == std::string_view::npos || linea.find('|', pos3 + 1) != std::string_view::npos) {
+        return analizarLinea(linea, minimo, maximo);
+    }
+
+    LineaAlumno resultado = {EstadoLinea::VALIDA, {}, linea.substr(0, pos1), 0, 0, 0};
+    EstadoLinea estado = convertirCalificacion(linea.substr(pos1 + 1, pos2 - pos1 - 1), resultado.calificacion1);
+    if (estado == EstadoLinea::VALIDA) {
+        estado = convertirCalificacion(linea.substr(pos2 + 1, pos3 - pos2 - 1), resultado.calificacion2);
+    }
+    if (estado == EstadoLinea::VALIDA) {
+        estado = convertirCalificacion(linea.substr(pos3 + 1), resultado.calificacion3);
+    }
+    if (estado != EstadoLinea::VALIDA) {
+        resultado.estado = estado;
+    } else if (resultado.calificacion1 < minimo || resultado.calificacion1 > maximo ||
+               resultado.calificacion2 < minimo || resultado.calificacion2 > maximo ||
+               resultado.calificacion3 < minimo || resultado.calificacion3 > maximo) {
+        resultado.estado = EstadoLinea::CALIFICACIONES_FUERA_DE_RANGO;
+    } else if (resultado.matricula.empty()) {
+        resultado.estado = EstadoLinea::CAMPOS_VACIOS;
+    }
+    return resultado;
+}
+
+
+// Líneas de un bloque del archivo ya analizadas. Las líneas vacías no se
+// guardan pero sí se cuentan, para numerar igual que la lectura secuencial.
+struct BloqueAnalizado {
+    struct Linea {
+        int numero;
+        LineaAlumno datos;
+    };
+
+    std::vector<Linea> lineas;
+    int totalLineas;
+};
+
+
+// Divide [datos, datos + tamano) en hasta `partes` bloques que terminan
+// justo después de un salto de línea (o al final del archivo).
+inline std::vector<std::string_view> dividirEnBloques(const char* datos, size_t tamano, int partes) {
+    std::vector<std::string_view> bloques;
+    if (partes < 1) partes = 1;
+    size_t objetivo = tamano / partes + 1;
+
+    const char* cursor = datos;
+    const char* fin = datos + tamano;
+    while (cursor < fin) {
+        const char* corte = cursor + objetivo < fin ? cursor + objetivo : fin;
+        if (corte < fin) {
+            const char* salto = static_cast<const char*>(std::memchr(corte, '\n', fin - corte));
+            corte = salto ? salto + 1 : fin;
+        }
+        bloques.push_back(std::string_view(cursor, corte - cursor));
+        cursor = corte;
+    }
+    return bloques;
+}
+
+
+inline void analizarBloque(std::string_view bloque, double minimo, double maximo, BloqueAnalizado& salida) {
+    salida.lineas.clear();
+    salida.totalLineas = 0;
+
+    const char* cursor = bloque.data();
+    const char* fin = cursor + bloque.size();
+    while (cursor < fin) {
+        const char* salto = static_cast<const char*>(std::memchr(cursor, '\n', fin - cursor));
+        const char* finLinea = salto ? salto : fin;
+        salida.totalLineas++;
+
+        LineaAlumno linea = analizarLinea(std::string_view(cursor, finLinea - cursor), minimo, maximo);
+        if (linea.estado != EstadoLinea::VACIA) {
+            salida.lineas.push_back(BloqueAnalizado::Linea{salida.totalLineas, linea});
+        }
+        cursor = salto ? salto + 1 : fin;
+    }
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+
+// Conjunto fijo de hilos trabajadores que atienden una cola de tareas.
+// enviar() devuelve un future con el resultado de la tarea.
+class PoolHilos {
+private:
+    std::vector<std::thread> trabajadores;
+    std::queue<std::function<void()>> tareas;
+    std::mutex candado;
+    std::condition_variable hayTrabajo;
+    bool detenido;
+
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+
+    void atender() {
+        while (true) {
+            std::function<void()> tarea;
+            {
+                std::unique_lock<std::mutex> bloqueo(candado);
+                hayTrabajo.wait(bloqueo, [this] { return detenido || !tareas.empty(); });
+                if (detenido && tareas.empty()) return;
+                tarea = std::move(tareas.front());
+                tareas.pop();
+            }
+            tarea();
+        }
+    }
+
+public:
+    explicit PoolHilos(int hilos) : detenido(false) {
+        if (hilos < 1) hilos = 1;
+        for (int i = 0; i < hilos; i++) {
+            trabajadores.emplace_back(&PoolHilos::atender, this);
+        }
+    }
+
+
+    ~PoolHilos() {
+        {
+            std::lock_guard<std::mutex> bloqueo(candado);
+            detenido = true;
+        }
+        hayTrabajo.notify_all();
+        for (size_t i = 0; i < trabajadores.size(); i++) {
+            trabajadores[i].join();
+        }
+    }
+
+
+    int tamano() const {
+        return static_cast<int>(trabajadores.size());
+    }
+
+
+    template <class Funcion>
+    auto enviar(Funcion funcion) -> std::future<decltype(funcion())> {
+        typedef decltype(funcion()) Resultado;
+        std::shared_ptr<std::packaged_task<Resultado()>> tarea =
+            std::make_shared<std::packaged_task<Resultado()>>(std::move(funcion));
+        std::future<Resultado> futuro = tarea->get_future();
+        {
+            std::lock_guard<std::mutex> bloqueo(candado);
+            tareas.push([tarea] { (*tarea)(); });
+        }
+        hayTrabajo.notify_one();
+        return futuro;
+    }
+};
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef RANKING_CALIFICACIONES_H
+#define RANKING_CALIFICACIONES_H
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+
+// Posiciones de los k valores mayores (mejores = true) o menores, ordenadas
+// del primero al último lugar. Los empates conservan el orden del registro.
+// Usa un montículo acotado a k elementos: O(N log k) sin copiar alumnos. Si
+// se da `ocupadas`, sólo se consideran las posiciones marcadas.
+inline std::vector<int> seleccionarExtremos(const double* valores, size_t n, size_t k, bool mejores,
+                                            const unsigned char* ocupadas = nullptr) {
+    typedef std::pair<double, int> Candidato;
+    auto antes = [mejores](const Candidato& a, const Candidato& b) {
+        if (a.first != b.first) return mejores ? a.first > b.first : a.first < b.first;
+        return a.second < b.second;
+    };
+
+    k = std::min(k, n);
+    std::vector<Candidato> monticulo;
+    monticulo.reserve(k);
+    if (k == 0) return std::vector<int>();
+
+    // La cima del montículo es el peor de los k seleccionados hasta ahora.
+    for (size_t i = 0; i < n; i++) {
+        if (ocupadas && !ocupadas[i]) continue;
+        Candidato candidato(valores[i], static_cast<int>(i));
+        if (monticulo.size() < k) {
+            monticulo.push_back(candidato);
+            std::push_heap(monticulo.begin(), monticulo.end(), antes);
+        } else if (antes(candidato, monticulo.front())) {
+            std::pop_heap(monticulo.begin(), monticulo.end(), antes);
+            monticulo.back() = candidato;
+            std::push_heap(monticulo.begin(), monticulo.end(), antes);
+        }
+    }
+    std::sort_heap(monticulo.begin(), monticulo.end(), antes);
+
+    std::vector<int> posiciones(monticulo.size());
+    for (size_t i = 0; i < monticulo.size(); i++) {
+        posiciones[i] = monticulo[i].second;
+    }
+    return posiciones;
+}
+
+
+// Índice ordenado por calificación final (en centésimas) que se mantiene con
+// cada alta, baja y modificación en O(log N). Las consultas recorren sólo
+// los k primeros o últimos elementos. Compactar el registro cambia las
+// posiciones, así que deja el índice desactualizado y se reconstruye en la
+// siguiente consulta.
+class IndiceRanking {
+private:
+    // (-centésimas, posición): el recorrido hacia adelante va de la mejor a
+    // la peor calificación y, en empates, por posición.
+    std::set<std::pair<int, int>> orden;
+    bool activo;
+    bool desactualizado;
+
+public:
+    IndiceRanking() : activo(false), desactualizado(false) {}
+
+
+    void activar(bool valor) {
+        activo = valor;
+        orden.clear();
+        desactualizado = valor;
+    }
+
+
+    bool estaActivo() const {
+        return activo;
+    }
+
+
+    bool necesitaReconstruir() const {
+        return activo && desactualizado;
+    }
+
+
+    void limpiar() {
+        orden.clear();
+        desactualizado = false;
+    }
+
+
+    void invalidar() {
+        if (!activo) return;
+        orden.clear();
+        desactualizado = true;
+    }
+
+
+    void reconstruir(const double* finales, size_t n, const unsigned char* ocupadas) {
+        orden.clear();
+        for (size_t i = 0; i < n; i++) {
+            if (!ocupadas[i]) continue;
+            orden.emplace(-static_cast<int>(std::llround(finales[i] * 100.0)), static_cast<int>(i));
+        }
+        desactualizado = false;
+    }
+
+
+    void insertar(int centesimas, int posicion) {
+        if (activo && !desactualizado) orden.emplace(-centesimas, posicion);
+    }
+
+
+    void eliminar(int centesimas, int posicion) {
+        if (activo && !desactualizado) orden.erase(std::make_pair(-centesimas, posicion));
+    }
+
+
+    std::vector<int> extremos(size_t k, bool mejores) const {
+        std::vector<int> posiciones;
+        posiciones.reserve(std::min(k, orden.size()));
+
+        if (mejores) {
+            for (auto it = orden.begin(); it != orden.end() && posiciones.size() < k; ++it) {
+                posiciones.push_back(it->second);
+            }
+            return posiciones;
+        }
+
+        // De la peor calificación hacia arriba, cada grupo de empates se
+        // recorre hacia adelante para conservar el orden por posición.
+        auto fin = orden.end();
+        while (posiciones.size() < k && fin != orden.begin()) {
+            int clave = std::prev(fin)->first;
+            auto inicio = orden.lower_bound(std::make_pair(clave, INT_MIN));
+            for (auto it = inicio; it != fin && posiciones.size() < k; ++it) {
+                posiciones.push_back(it->second);
+            }
+            fin = inicio;
+        }
+        return posiciones;
+    }
+};
+
+#endif
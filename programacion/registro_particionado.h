@@ -0,0 +1,332 @@
+#ifndef REGISTRO_PARTICIONADO_H
+#define REGISTRO_PARTICIONADO_H
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "sistema_core.h"
+#include "pool_hilos.h"
+
+
+// Registro repartido por matrícula en N particiones (por ejemplo, una por
+// plantel), cada una un SistemaAdministrativo con su propio almacenamiento
+// y su propio archivo. Lo que toca a un alumno va sólo a su partición; las
+// consultas de todo el registro se reparten entre las particiones en un
+// grupo de hilos y se combinan los resultados parciales. Como
+// SistemaAdministrativo, no admite llamadas simultáneas desde varios hilos.
+class RegistroParticionado {
+private:
+    std::vector<SistemaAdministrativo> particiones;
+    mutable PoolHilos pool;
+
+    RegistroParticionado(const RegistroParticionado&) = delete;
+    RegistroParticionado& operator=(const RegistroParticionado&) = delete;
+
+
+    // Ejecuta consulta(elemento) para cada elemento (las particiones o los
+    // bloques de un archivo) en el grupo de hilos y devuelve los resultados
+    // en el mismo orden.
+    template <typename Elementos, typename F>
+    static auto repartir(PoolHilos& pool, Elementos& elementos, F consulta)
+        -> std::vector<decltype(consulta(elementos[0]))> {
+        typedef decltype(consulta(elementos[0])) Resultado;
+        std::vector<std::future<Resultado>> pendientes;
+        pendientes.reserve(elementos.size());
+        for (size_t i = 0; i < elementos.size(); i++) {
+            pendientes.push_back(pool.enviar([&elementos, &consulta, i] { return consulta(elementos[i]); }));
+        }
+
+        std::vector<Resultado> resultados;
+        resultados.reserve(pendientes.size());
+        for (size_t i = 0; i < pendientes.size(); i++) {
+            resultados.push_back(pendientes[i].get());
+        }
+        return resultados;
+    }
+
+
+    // Las K primeras fichas de la partición y todas las empatadas con la
+    // K-ésima. Cada partición desempata por posición (y el índice de ranking
+    // agrupa por centésimas), así que sin los empatados el corte de la
+    // partición decidiría cuáles llegan a la mezcla.
+    static std::vector<FichaAlumno> candidatosExtremos(const SistemaAdministrativo& particion, size_t k,
+                                                       bool mejores) {
+        if (k == 0) return std::vector<FichaAlumno>();
+        auto centesimas = [](const FichaAlumno& ficha) { return std::llround(ficha.calificacionFinal * 100.0); };
+        for (size_t pedidas = k + 1; ; pedidas *= 2) {
+            std::vector<FichaAlumno> fichas = particion.fichasExtremas(pedidas, mejores);
+            if (fichas.size() < pedidas || centesimas(fichas.back()) != centesimas(fichas[k - 1])) return fichas;
+        }
+    }
+
+
+    int indiceDe(const SistemaAdministrativo& particion) const {
+        return static_cast<int>(&particion - particiones.data());
+    }
+
+
+    std::vector<FichaAlumno> reunirFichas(std::vector<int> (SistemaAdministrativo::*consulta)()) {
+        std::vector<std::vector<FichaAlumno>> parciales = repartir(pool, particiones,
+            [consulta](SistemaAdministrativo& particion) {
+                std::vector<int> posiciones = (particion.*consulta)();
+                std::vector<FichaAlumno> fichas;
+                fichas.reserve(posiciones.size());
+                for (int posicion : posiciones) {
+                    fichas.push_back(particion.fichaDe(posicion));
+                }
+                return fichas;
+            });
+
+        size_t total = 0;
+        for (size_t i = 0; i < parciales.size(); i++) total += parciales[i].size();
+        std::vector<FichaAlumno> fichas;
+        fichas.reserve(total);
+        for (size_t i = 0; i < parciales.size(); i++) {
+            std::move(parciales[i].begin(), parciales[i].end(), std::back_inserter(fichas));
+        }
+        return fichas;
+    }
+
+public:
+    // `hilos` = 0 usa un hilo por partición, hasta el número de núcleos.
+    explicit RegistroParticionado(int cantidad, int hilos = 0)
+        : particiones(std::max(cantidad, 1)),
+          pool(hilos > 0 ? hilos : std::min(std::max(cantidad, 1),
+                                            std::max(1, static_cast<int>(std::thread::hardware_concurrency())))) {}
+
+
+    // Usa los bits altos del hash de la matrícula: los bajos son los que
+    // usa el índice de cada partición, que así no se concentra en una parte
+    // de su tabla. La asignación no cambia entre ejecuciones.
+    static int particionDe(std::string_view matricula, int cantidad) {
+        uint64_t hash = IndiceMatriculas::calcularHash(matricula);
+        return static_cast<int>((hash * static_cast<uint64_t>(cantidad)) >> 32);
+    }
+
+
+    int particionDe(std::string_view matricula) const {
+        return particionDe(matricula, cantidadParticiones());
+    }
+
+
+    int cantidadParticiones() const {
+        return static_cast<int>(particiones.size());
+    }
+
+
+    SistemaAdministrativo& particion(int indice) {
+        return particiones[indice];
+    }
+
+
+    const SistemaAdministrativo& particion(int indice) const {
+        return particiones[indice];
+    }
+
+
+    int getCantidadAlumnos() const {
+        int total = 0;
+        for (size_t i = 0; i < particiones.size(); i++) total += particiones[i].getCantidadAlumnos();
+        return total;
+    }
+
+
+    bool insertar(const Alumno& alumno) {
+        return particiones[particionDe(alumno.matricula)].insertar(alumno);
+    }
+
+
+    bool buscar(std::string_view matricula, FichaAlumno& ficha) const {
+        return particiones[particionDe(matricula)].buscar(matricula, ficha);
+    }
+
+
+    // Si la nueva matrícula pertenece a otra partición, el alumno se da de
+    // alta en ella y de baja en la suya.
+    bool actualizar(std::string_view matricula, const Alumno& alumno) {
+        SistemaAdministrativo& origen = particiones[particionDe(matricula)];
+        SistemaAdministrativo& destino = particiones[particionDe(alumno.matricula)];
+        if (&origen == &destino) return origen.actualizar(matricula, alumno);
+        if (origen.buscarIndice(matricula) == -1 || !destino.insertar(alumno)) return false;
+        return origen.eliminarPorMatricula(matricula);
+    }
+
+
+    bool eliminarPorMatricula(std::string_view matricula) {
+        return particiones[particionDe(matricula)].eliminarPorMatricula(matricula);
+    }
+
+
+    ResumenCalificaciones resumirFinales() const {
+        std::vector<ResumenCalificaciones> parciales = repartir(pool, particiones,
+            [](const SistemaAdministrativo& particion) { return particion.resumirFinales(); });
+
+        ResumenCalificaciones total = {0, 0.0, 0.0, 0.0, 0.0, 0};
+        for (const ResumenCalificaciones& parcial : parciales) {
+            if (parcial.cantidad == 0) continue;
+            total.minimo = total.cantidad == 0 ? parcial.minimo : std::min(total.minimo, parcial.minimo);
+            total.maximo = total.cantidad == 0 ? parcial.maximo : std::max(total.maximo, parcial.maximo);
+            total.cantidad += parcial.cantidad;
+            total.suma += parcial.suma;
+            total.sumaCuadrados += parcial.sumaCuadrados;
+            total.aprobados += parcial.aprobados;
+        }
+        return total;
+    }
+
+
+    double calcularPromedioGeneral() const {
+        return SistemaAdministrativo::promedioDe(resumirFinales());
+    }
+
+
+    double calcularDesviacionEstandar() const {
+        return SistemaAdministrativo::desviacionDe(resumirFinales());
+    }
+
+
+    // Cada partición aporta sus K mejores (o peores) con los empatados en el
+    // corte y se eligen los K del conjunto; los empates se ordenan por
+    // matrícula, así que el resultado no depende de la cantidad de particiones.
+    std::vector<FichaAlumno> fichasExtremas(size_t k, bool mejores) const {
+        std::vector<std::vector<FichaAlumno>> parciales = repartir(pool, particiones,
+            [k, mejores](const SistemaAdministrativo& particion) { return candidatosExtremos(particion, k, mejores); });
+
+        std::vector<FichaAlumno> fichas;
+        for (size_t i = 0; i < parciales.size(); i++) {
+            std::move(parciales[i].begin(), parciales[i].end(), std::back_inserter(fichas));
+        }
+        size_t cantidad = std::min(k, fichas.size());
+        std::partial_sort(fichas.begin(), fichas.begin() + cantidad, fichas.end(),
+                          [mejores](const FichaAlumno& a, const FichaAlumno& b) {
+                              if (a.calificacionFinal != b.calificacionFinal) {
+                                  return mejores ? a.calificacionFinal > b.calificacionFinal
+                                                 : a.calificacionFinal < b.calificacionFinal;
+                              }
+                              return a.matricula < b.matricula;
+                          });
+        fichas.resize(cantidad);
+        return fichas;
+    }
+
+
+    // Fichas por partición, y dentro de cada una en el orden del registro.
+    std::vector<FichaAlumno> alumnosAprobados() {
+        return reunirFichas(&SistemaAdministrativo::alumnosAprobados);
+    }
+
+
+    std::vector<FichaAlumno> alumnosReprobados() {
+        return reunirFichas(&SistemaAdministrativo::alumnosReprobados);
+    }
+
+
+    // Reparte un archivo con el formato de alumnos.txt: las líneas se
+    // analizan por bloques en paralelo, se asignan a su partición en el
+    // orden del archivo y cada partición da de alta las suyas en paralelo.
+    // Como en la carga normal, de una matrícula repetida queda la primera.
+    // Devuelve los alumnos dados de alta, o -1 si no se pudo abrir el
+    // archivo; `rechazados` cuenta las líneas inválidas o duplicadas.
+    int importar(const std::string& nombreArchivo, int& rechazados) {
+        rechazados = 0;
+        ArchivoMapeado archivo;
+        if (!archivo.abrir(nombreArchivo)) return -1;
+
+        std::vector<std::string_view> bloques = dividirEnBloques(archivo.datos(), archivo.tamano(),
+                                                                 pool.tamano() * 4);
+        std::vector<BloqueAnalizado> analizados = repartir(pool, bloques, [](std::string_view bloque) {
+            BloqueAnalizado analizado;
+            analizarBloque(bloque, CALIFICACION_MIN, CALIFICACION_MAX, analizado);
+            return analizado;
+        });
+
+        std::vector<std::vector<LineaAlumno>> porParticion(particiones.size());
+        for (size_t i = 0; i < analizados.size(); i++) {
+            for (const BloqueAnalizado::Linea& linea : analizados[i].lineas) {
+                if (linea.datos.estado != EstadoLinea::VALIDA) {
+                    rechazados++;
+                    continue;
+                }
+                porParticion[particionDe(linea.datos.matricula)].push_back(linea.datos);
+            }
+        }
+
+        std::vector<int> altas = repartir(pool, particiones, [this, &porParticion](SistemaAdministrativo& particion) {
+            const std::vector<LineaAlumno>& lineas = porParticion[indiceDe(particion)];
+            particion.reservar(particion.getCantidadAlumnos() + static_cast<int>(lineas.size()));
+            int dadas = 0;
+            for (const LineaAlumno& linea : lineas) {
+                dadas += particion.insertar(Alumno(linea.nombre, linea.matricula, linea.calificacion1,
+                                                   linea.calificacion2, linea.calificacion3));
+            }
+            return dadas;
+        });
+
+        int total = 0;
+        for (size_t i = 0; i < altas.size(); i++) {
+            total += altas[i];
+            rechazados += static_cast<int>(porParticion[i].size()) - altas[i];
+        }
+        return total;
+    }
+
+
+    // Archivo de la partición `indice`: base.<indice>.bin.
+    static std::string archivoParticion(const std::string& base, int indice) {
+        return base + "." + std::to_string(indice) + ".bin";
+    }
+
+
+    // Archivo con la cantidad de particiones con que se guardó: base.particiones.
+    static std::string archivoCantidad(const std::string& base) {
+        return base + ".particiones";
+    }
+
+
+    // Cantidad de particiones con que se guardó `base`, o 0 si no se pudo leer.
+    static int cantidadGuardada(const std::string& base) {
+        ArchivoMapeado archivo;
+        if (!archivo.abrir(archivoCantidad(base))) return 0;
+        int cantidad = 0;
+        std::from_chars(archivo.datos(), archivo.datos() + archivo.tamano(), cantidad);
+        return cantidad;
+    }
+
+
+    // Cada partición guarda y carga su propia instantánea en paralelo; al
+    // final se guarda la cantidad de particiones. Como cada alumno se busca
+    // en la partición que le toca por su matrícula, cargarBinario no carga
+    // nada y devuelve false si la cantidad guardada no es la del registro.
+    bool guardarBinario(const std::string& base) const {
+        std::vector<bool> correctos = repartir(pool, particiones, [this, &base](const SistemaAdministrativo& particion) {
+            return particion.guardarBinario(archivoParticion(base, indiceDe(particion)));
+        });
+        if (std::find(correctos.begin(), correctos.end(), false) != correctos.end()) return false;
+
+        EscritorBuffer archivo;
+        if (!archivo.abrirReemplazo(archivoCantidad(base))) return false;
+        archivo << cantidadParticiones() << '\n';
+        return archivo.cerrar();
+    }
+
+
+    bool cargarBinario(const std::string& base) {
+        if (cantidadGuardada(base) != cantidadParticiones()) return false;
+
+        std::vector<bool> correctos = repartir(pool, particiones, [this, &base](SistemaAdministrativo& particion) {
+            return particion.cargarBinario(archivoParticion(base, indiceDe(particion)));
+        });
+        return std::find(correctos.begin(), correctos.end(), false) == correctos.end();
+    }
+};
+
+#endif
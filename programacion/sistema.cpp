@@ -2,840 +2,639 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
-#include <cmath>
 #include <algorithm>
 #include <limits>
-#include <sstream>
+#include <cstdlib>
+#include <vector>
+
+#include "sistema_core.h"
+#include "guardado_segundo_plano.h"
 
 using namespace std;
 
 
-const double CALIFICACION_MIN = 0.0;
-const double CALIFICACION_MAX = 100.0;
-const int CAPACIDAD_INICIAL = 10;
+const char* const ARCHIVO_TEXTO = "alumnos.txt";
+const char* const ARCHIVO_BINARIO = "alumnos.bin";
+const char* const ARCHIVO_BITACORA = "alumnos.log";
+const size_t CAMBIOS_MINIMOS_COMPACTACION = 1000;
+const int RESULTADOS_MAXIMOS_BUSQUEDA = 50;
 
 
-struct Alumno {
-    string nombre;
-    string matricula;
-    double calificacion1;
-    double calificacion2;
-    double calificacion3;
-    double calificacionFinal;
-    
+// Interfaz de consola: cada opción del menú pide sus datos, llama a la API
+// de SistemaAdministrativo (sistema_core.h) y muestra el resultado.
+
+bool leerCalificacion(double& calificacion, const string& mensaje) {
+    cout << mensaje;
+    string entrada;
+    cin >> entrada;
+    
+    try {
+        calificacion = stod(entrada);
+        if (calificacion < CALIFICACION_MIN || calificacion > CALIFICACION_MAX) {
+            cout << "Error: La calificación debe estar entre " 
+                 << CALIFICACION_MIN << " y " << CALIFICACION_MAX << "." << endl;
+            return false;
+        }
+        return true;
+    } catch (const invalid_argument&) {
+        cout << "Error: Entrada inválida. Debe ser un número." << endl;
+        return false;
+    } catch (const out_of_range&) {
+        cout << "Error: Número fuera de rango." << endl;
+        return false;
+    }
+}
+
+
+void limpiarBuffer() {
+    cin.clear();
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+}
+
+
+bool validarCadenaNoVacia(const string& cadena, const string& campo) {
+    if (cadena.empty() || cadena.find_first_not_of(" \t\n") == string::npos) {
+        cout << "Error: El campo '" << campo << "' no puede estar vacío." << endl;
+        return false;
+    }
+    return true;
+}
+
+
+// Pide una matrícula y busca al alumno; muestra el aviso si no existe.
+bool leerAlumnoExistente(SistemaAdministrativo& sistema, const char* mensaje, const char* noEncontrado,
+                         string& matricula, FichaAlumno& ficha) {
+    cout << mensaje;
+    cin >> matricula;
+    
+    if (!sistema.buscar(matricula, ficha)) {
+        cout << noEncontrado << endl;
+        return false;
+    }
+    return true;
+}
+
+
+void mostrarAlumno(const FichaAlumno& alumno) {
+    cout << "\n" << string(40, '-') << endl;
+    cout << "   INFORMACIÓN DEL ALUMNO" << endl;
+    cout << string(40, '-') << endl;
+    cout << left << setw(15) << "Nombre:" << alumno.nombre << endl;
+    cout << setw(15) << "Matrícula:" << alumno.matricula << endl;
+    cout << setw(15) << "Parcial 1:" << fixed << setprecision(2) 
+         << alumno.calificacion1 << endl;
+    cout << setw(15) << "Parcial 2:" << alumno.calificacion2 << endl;
+    cout << setw(15) << "Parcial 3:" << alumno.calificacion3 << endl;
+    cout << setw(15) << "Calificación Final:" << alumno.calificacionFinal << endl;
+    cout << setw(15) << "Estado:" 
+         << (alumno.estaAprobado() ? "APROBADO" : "REPROBADO") << endl;
+    cout << string(40, '-') << endl;
+}
+
+
+bool agregarAlumno(SistemaAdministrativo& sistema) {
+    string nombre, matricula;
+    double cal1, cal2, cal3;
     
-    Alumno() : calificacion1(0), calificacion2(0), calificacion3(0), calificacionFinal(0) {}
+    cout << "\n=== AGREGAR ALUMNO ===" << endl;
     
     
-    Alumno(string nom, string mat, double c1, double c2, double c3) 
-        : nombre(nom), matricula(mat), calificacion1(c1), calificacion2(c2), calificacion3(c3) {
-        calcularCalificacionFinal();
+    cout << "Nombre completo: ";
+    limpiarBuffer();
+    getline(cin, nombre);
+    if (!validarCadenaNoVacia(nombre, "Nombre")) {
+        return false;
     }
     
     
-    void calcularCalificacionFinal() {
-        calificacionFinal = (calificacion1 + calificacion2 + calificacion3) / 3.0;
-        
-        calificacionFinal = round(calificacionFinal * 100.0) / 100.0;
+    cout << "Matrícula: ";
+    getline(cin, matricula);
+    if (!validarCadenaNoVacia(matricula, "Matrícula")) {
+        return false;
     }
     
     
-    bool estaAprobado() const {
-        return calificacionFinal >= 70.0;
+    if (sistema.buscarIndice(matricula) != -1) {
+        cout << "Error: Ya existe un alumno con esa matrícula." << endl;
+        return false;
     }
     
     
-    bool validarCalificaciones() const {
-        return (calificacion1 >= CALIFICACION_MIN && calificacion1 <= CALIFICACION_MAX &&
-                calificacion2 >= CALIFICACION_MIN && calificacion2 <= CALIFICACION_MAX &&
-                calificacion3 >= CALIFICACION_MIN && calificacion3 <= CALIFICACION_MAX);
+    if (!leerCalificacion(cal1, "Calificación parcial 1: ")) {
+        return false;
+    }
+    if (!leerCalificacion(cal2, "Calificación parcial 2: ")) {
+        return false;
+    }
+    if (!leerCalificacion(cal3, "Calificación parcial 3: ")) {
+        return false;
     }
     
     
-    bool validarDatos() const {
-        return !nombre.empty() && !matricula.empty() && validarCalificaciones();
+    if (!sistema.insertar(Alumno(nombre, matricula, cal1, cal2, cal3))) {
+        cout << "Error: No se pudo asignar memoria." << endl;
+        return false;
     }
-};
+    
+    cout << "\nAlumno agregado exitosamente." << endl;
+    return true;
+}
 
 
-class SistemaAdministrativo {
-private:
-    Alumno* alumnos;
-    int cantidadAlumnos;
-    int capacidad;
-    
-    
-    void redimensionar(int nuevaCapacidad) {
-        if (nuevaCapacidad <= capacidad) return;
-        
-        Alumno* nuevo = new (nothrow) Alumno[nuevaCapacidad];
-        if (!nuevo) {
-            cerr << "Error: No se pudo asignar memoria." << endl;
-            return;
-        }
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            nuevo[i] = alumnos[i];
-        }
-        
-        delete[] alumnos;
-        alumnos = nuevo;
-        capacidad = nuevaCapacidad;
+void leerAlumno(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
-    
-    int buscarIndice(const string& matricula) const {
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            if (alumnos[i].matricula == matricula) {
-                return i;
-            }
-        }
-        return -1;
+    string matricula;
+    FichaAlumno alumno;
+    cout << "\n=== LEER ALUMNO ===" << endl;
+    if (leerAlumnoExistente(sistema, "Ingrese la matrícula: ", "Alumno no encontrado.", matricula, alumno)) {
+        mostrarAlumno(alumno);
     }
-    
-    
-    bool leerCalificacion(double& calificacion, const string& mensaje) {
-        cout << mensaje;
-        string entrada;
-        cin >> entrada;
-        
-        try {
-            calificacion = stod(entrada);
-            if (calificacion < CALIFICACION_MIN || calificacion > CALIFICACION_MAX) {
-                cout << "Error: La calificación debe estar entre " 
-                     << CALIFICACION_MIN << " y " << CALIFICACION_MAX << "." << endl;
-                return false;
-            }
-            return true;
-        } catch (const invalid_argument&) {
-            cout << "Error: Entrada inválida. Debe ser un número." << endl;
-            return false;
-        } catch (const out_of_range&) {
-            cout << "Error: Número fuera de rango." << endl;
-            return false;
-        }
+}
+
+
+void buscarAlumnoPorNombre(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
-    
-    void limpiarBuffer() {
-        cin.clear();
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    string texto;
+    cout << "\n=== BUSCAR ALUMNO POR NOMBRE ===" << endl;
+    cout << "Nombre o parte del nombre: ";
+    limpiarBuffer();
+    getline(cin, texto);
+    if (!validarCadenaNoVacia(texto, "Nombre")) {
+        return;
     }
     
-    
-    bool validarCadenaNoVacia(const string& cadena, const string& campo) {
-        if (cadena.empty() || cadena.find_first_not_of(" \t\n") == string::npos) {
-            cout << "Error: El campo '" << campo << "' no puede estar vacío." << endl;
-            return false;
-        }
-        return true;
+    int tipo;
+    cout << "1. Palabras que empiezan con el texto" << endl;
+    cout << "2. Nombres que contienen el texto" << endl;
+    cout << "Opción: ";
+    if (!(cin >> tipo) || (tipo != 1 && tipo != 2)) {
+        limpiarBuffer();
+        cout << "Opción inválida." << endl;
+        return;
     }
     
-public:
-    SistemaAdministrativo() : alumnos(nullptr), cantidadAlumnos(0), capacidad(CAPACIDAD_INICIAL) {
-        alumnos = new (nothrow) Alumno[capacidad];
-        if (!alumnos) {
-            cerr << "Error crítico: No se pudo inicializar el sistema." << endl;
-            capacidad = 0;
-        }
+    vector<int> posiciones = sistema.buscarPorNombre(texto, tipo == 1);
+    if (posiciones.empty()) {
+        cout << "No se encontraron alumnos." << endl;
+        return;
     }
     
+    size_t mostrados = min(posiciones.size(), static_cast<size_t>(RESULTADOS_MAXIMOS_BUSQUEDA));
+    for (size_t i = 0; i < mostrados; i++) {
+        FichaAlumno alumno = sistema.fichaDe(posiciones[i]);
+        cout << "\n" << (i + 1) << ". " << alumno.nombre 
+             << " (Matrícula: " << alumno.matricula << ")" << endl;
+        cout << "   Calificación Final: " << fixed << setprecision(2) 
+             << alumno.calificacionFinal << endl;
+    }
+    if (mostrados < posiciones.size()) {
+        cout << "\n... y " << posiciones.size() - mostrados << " más; precise la búsqueda." << endl;
+    }
+    cout << "\nTotal: " << posiciones.size() << " alumno(s) encontrado(s)." << endl;
+}
+
+
+void modificarAlumno(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
+    }
     
-    SistemaAdministrativo(const SistemaAdministrativo& otro) 
-        : cantidadAlumnos(otro.cantidadAlumnos), capacidad(otro.capacidad) {
-        alumnos = new (nothrow) Alumno[capacidad];
-        if (alumnos) {
-            for (int i = 0; i < cantidadAlumnos; i++) {
-                alumnos[i] = otro.alumnos[i];
-            }
-        }
+    string matricula;
+    FichaAlumno actual;
+    cout << "\n=== MODIFICAR ALUMNO ===" << endl;
+    if (!leerAlumnoExistente(sistema, "Ingrese la matrícula del alumno a modificar: ", "Alumno no encontrado.",
+                             matricula, actual)) {
+        return;
     }
     
+    cout << "\nDatos actuales:" << endl;
+    mostrarAlumno(actual);
     
-    SistemaAdministrativo& operator=(const SistemaAdministrativo& otro) {
-        if (this != &otro) {
-            delete[] alumnos;
-            cantidadAlumnos = otro.cantidadAlumnos;
-            capacidad = otro.capacidad;
-            alumnos = new (nothrow) Alumno[capacidad];
-            if (alumnos) {
-                for (int i = 0; i < cantidadAlumnos; i++) {
-                    alumnos[i] = otro.alumnos[i];
-                }
-            }
-        }
-        return *this;
-    }
+    int opcion;
+    cout << "\n¿Qué desea modificar?" << endl;
+    cout << "1. Nombre" << endl;
+    cout << "2. Matrícula" << endl;
+    cout << "3. Calificaciones" << endl;
+    cout << "4. Todo" << endl;
+    cout << "5. Cancelar" << endl;
+    cout << "Opción: ";
     
-    ~SistemaAdministrativo() {
-        delete[] alumnos;
+    if (!(cin >> opcion)) {
+        limpiarBuffer();
+        cout << "Error: Entrada inválida." << endl;
+        return;
     }
     
+    limpiarBuffer();
     
-    bool cargarDesdeArchivo(const string& nombreArchivo) {
-        ifstream archivo(nombreArchivo);
-        if (!archivo.is_open()) {
-            return false;
-        }
-        
-        cantidadAlumnos = 0;
-        string linea;
-        int numeroLinea = 0;
-        int alumnosCargados = 0;
-        int errores = 0;
-        
-        while (getline(archivo, linea)) {
-            numeroLinea++;
-            
-            
-            linea.erase(0, linea.find_first_not_of(" \t\n\r"));
-            linea.erase(linea.find_last_not_of(" \t\n\r") + 1);
-            
-            if (linea.empty()) continue;
-            
-            
-            size_t pos1 = linea.find('|');
-            if (pos1 == string::npos) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (formato inválido)." << endl;
-                errores++;
-                continue;
+    switch (opcion) {
+        case 1: {
+            cout << "Nuevo nombre: ";
+            string nuevoNombre;
+            getline(cin, nuevoNombre);
+            if (validarCadenaNoVacia(nuevoNombre, "Nombre")) {
+                sistema.actualizar(matricula, Alumno(nuevoNombre, actual.matricula, actual.calificacion1,
+                                                     actual.calificacion2, actual.calificacion3));
+                cout << "\nAlumno modificado exitosamente." << endl;
             }
-            
-            string nombre = linea.substr(0, pos1);
-            size_t pos2 = linea.find('|', pos1 + 1);
-            if (pos2 == string::npos) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (formato inválido)." << endl;
-                errores++;
-                continue;
+            break;
+        }
+        case 2: {
+            string nuevaMatricula;
+            cout << "Nueva matrícula: ";
+            getline(cin, nuevaMatricula);
+            if (!validarCadenaNoVacia(nuevaMatricula, "Matrícula")) {
+                return;
             }
-            
-            string matricula = linea.substr(pos1 + 1, pos2 - pos1 - 1);
-            size_t pos3 = linea.find('|', pos2 + 1);
-            if (pos3 == string::npos) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (formato inválido)." << endl;
-                errores++;
-                continue;
+            if (sistema.buscarIndice(nuevaMatricula) != -1 && nuevaMatricula != matricula) {
+                cout << "Error: Ya existe un alumno con esa matrícula." << endl;
+                return;
             }
-            
+            sistema.actualizar(matricula, Alumno(actual.nombre, nuevaMatricula, actual.calificacion1,
+                                                 actual.calificacion2, actual.calificacion3));
+            cout << "\nAlumno modificado exitosamente." << endl;
+            break;
+        }
+        case 3: {
             double cal1, cal2, cal3;
-            try {
-                cal1 = stod(linea.substr(pos2 + 1, pos3 - pos2 - 1));
-                size_t pos4 = linea.find('|', pos3 + 1);
-                if (pos4 == string::npos) {
-                    cerr << "Advertencia: Línea " << numeroLinea 
-                         << " ignorada (formato inválido)." << endl;
-                    errores++;
-                    continue;
-                }
-                
-                cal2 = stod(linea.substr(pos3 + 1, pos4 - pos3 - 1));
-                cal3 = stod(linea.substr(pos4 + 1));
-                
-                
-                if (cal1 < CALIFICACION_MIN || cal1 > CALIFICACION_MAX ||
-                    cal2 < CALIFICACION_MIN || cal2 > CALIFICACION_MAX ||
-                    cal3 < CALIFICACION_MIN || cal3 > CALIFICACION_MAX) {
-                    cerr << "Advertencia: Línea " << numeroLinea 
-                         << " ignorada (calificaciones fuera de rango)." << endl;
-                    errores++;
-                    continue;
+            if (leerCalificacion(cal1, "Nueva calificación parcial 1: ")) {
+                if (leerCalificacion(cal2, "Nueva calificación parcial 2: ")) {
+                    if (leerCalificacion(cal3, "Nueva calificación parcial 3: ")) {
+                        sistema.actualizar(matricula, Alumno(actual.nombre, actual.matricula, cal1, cal2, cal3));
+                        cout << "\n Alumno modificado exitosamente." << endl;
+                    }
                 }
-                
-            } catch (const invalid_argument&) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (calificaciones inválidas)." << endl;
-                errores++;
-                continue;
-            } catch (const out_of_range&) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (números fuera de rango)." << endl;
-                errores++;
-                continue;
+            }
+            break;
+        }
+        case 4: {
+            cout << "Nuevo nombre: ";
+            string nuevoNombre;
+            getline(cin, nuevoNombre);
+            if (!validarCadenaNoVacia(nuevoNombre, "Nombre")) {
+                return;
             }
             
-            
-            if (nombre.empty() || matricula.empty()) {
-                cerr << "Advertencia: Línea " << numeroLinea 
-                     << " ignorada (nombre o matrícula vacíos)." << endl;
-                errores++;
-                continue;
+            string nuevaMatricula;
+            cout << "Nueva matrícula: ";
+            getline(cin, nuevaMatricula);
+            if (!validarCadenaNoVacia(nuevaMatricula, "Matrícula")) {
+                return;
             }
             
+            if (sistema.buscarIndice(nuevaMatricula) != -1 && nuevaMatricula != matricula) {
+                cout << "Error: Ya existe un alumno con esa matrícula." << endl;
+                return;
+            }
             
-            if (cantidadAlumnos > 0) {
-                bool duplicado = false;
-                for (int i = 0; i < cantidadAlumnos; i++) {
-                    if (alumnos[i].matricula == matricula) {
-                        cerr << "Advertencia: Línea " << numeroLinea 
-                             << " ignorada (matrícula duplicada: " << matricula << ")." << endl;
-                        errores++;
-                        duplicado = true;
-                        break;
+            double cal1, cal2, cal3;
+            if (leerCalificacion(cal1, "Nueva calificación parcial 1: ")) {
+                if (leerCalificacion(cal2, "Nueva calificación parcial 2: ")) {
+                    if (leerCalificacion(cal3, "Nueva calificación parcial 3: ")) {
+                        sistema.actualizar(matricula, Alumno(nuevoNombre, nuevaMatricula, cal1, cal2, cal3));
+                        cout << "\n Alumno modificado exitosamente." << endl;
                     }
                 }
-                if (duplicado) continue;
-            }
-            
-            
-            if (cantidadAlumnos >= capacidad) {
-                redimensionar(capacidad * 2);
             }
-            
-            alumnos[cantidadAlumnos] = Alumno(nombre, matricula, cal1, cal2, cal3);
-            cantidadAlumnos++;
-            alumnosCargados++;
-        }
-        
-        archivo.close();
-        
-        if (errores > 0) {
-            cout << "Se encontraron " << errores << " error(es) al cargar el archivo." << endl;
+            break;
         }
-        
-        return alumnosCargados > 0 || cantidadAlumnos > 0;
+        case 5:
+            cout << "Operación cancelada." << endl;
+            break;
+        default:
+            cout << "Opción inválida." << endl;
+            return;
+    }
+}
+
+
+void eliminarAlumno(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
-    
-    bool guardarEnArchivo(const string& nombreArchivo) {
-        if (cantidadAlumnos == 0) {
-            
-            ofstream archivo(nombreArchivo);
-            archivo.close();
-            return true;
-        }
-        
-        ofstream archivo(nombreArchivo);
-        if (!archivo.is_open()) {
-            cerr << "Error: No se pudo abrir el archivo para escritura." << endl;
-            return false;
-        }
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            if (alumnos[i].validarDatos()) {
-                archivo << alumnos[i].nombre << "|"
-                        << alumnos[i].matricula << "|"
-                        << fixed << setprecision(2)
-                        << alumnos[i].calificacion1 << "|"
-                        << alumnos[i].calificacion2 << "|"
-                        << alumnos[i].calificacion3 << endl;
-            }
-        }
-        
-        archivo.close();
-        return archivo.good() || archivo.eof();
+    string matricula;
+    FichaAlumno alumno;
+    cout << "\n=== ELIMINAR ALUMNO ===" << endl;
+    if (!leerAlumnoExistente(sistema, "Ingrese la matrícula del alumno a eliminar: ", " Alumno no encontrado.",
+                             matricula, alumno)) {
+        return;
     }
     
+    cout << "\nEstá seguro de eliminar a " << alumno.nombre 
+         << " (Matrícula: " << alumno.matricula << ")? (s/n): ";
+    char confirmacion;
+    cin >> confirmacion;
+    limpiarBuffer();
     
-    bool agregarAlumno() {
-        if (!alumnos) {
-            cout << "Error: Sistema no inicializado correctamente." << endl;
-            return false;
-        }
-        
-        string nombre, matricula;
-        double cal1, cal2, cal3;
+    if (confirmacion == 's' || confirmacion == 'S') {
         
-        cout << "\n=== AGREGAR ALUMNO ===" << endl;
-        
-        
-        cout << "Nombre completo: ";
-        limpiarBuffer();
-        getline(cin, nombre);
-        if (!validarCadenaNoVacia(nombre, "Nombre")) {
-            return false;
-        }
-        
-        
-        cout << "Matrícula: ";
-        getline(cin, matricula);
-        if (!validarCadenaNoVacia(matricula, "Matrícula")) {
-            return false;
-        }
-        
-        
-        if (buscarIndice(matricula) != -1) {
-            cout << "Error: Ya existe un alumno con esa matrícula." << endl;
-            return false;
-        }
-        
-        
-        if (!leerCalificacion(cal1, "Calificación parcial 1: ")) {
-            return false;
-        }
-        if (!leerCalificacion(cal2, "Calificación parcial 2: ")) {
-            return false;
-        }
-        if (!leerCalificacion(cal3, "Calificación parcial 3: ")) {
-            return false;
-        }
-        
-        
-        if (cantidadAlumnos >= capacidad) {
-            redimensionar(capacidad * 2);
-            if (!alumnos) {
-                cout << "Error: No se pudo asignar memoria." << endl;
-                return false;
-            }
-        }
-        
-        alumnos[cantidadAlumnos] = Alumno(nombre, matricula, cal1, cal2, cal3);
-        cantidadAlumnos++;
-        
-        cout << "\nAlumno agregado exitosamente." << endl;
-        return true;
+        sistema.eliminarPorMatricula(matricula);
+        cout << "\nAlumno eliminado exitosamente." << endl;
+    } else {
+        cout << "Operación cancelada." << endl;
+    }
+}
+
+
+void buscarYAnalizar(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    string matricula;
+    FichaAlumno alumno;
+    cout << "\n=== BÚSQUEDA Y ANÁLISIS ===" << endl;
+    if (!leerAlumnoExistente(sistema, "Ingrese la matrícula: ", " Alumno no encontrado.", matricula, alumno)) {
+        return;
+    }
     
-    void leerAlumno() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        string matricula;
-        cout << "\n=== LEER ALUMNO ===" << endl;
-        cout << "Ingrese la matrícula: ";
-        cin >> matricula;
-        
-        int indice = buscarIndice(matricula);
-        if (indice == -1) {
-            cout << "Alumno no encontrado." << endl;
-            return;
+    mostrarAlumno(alumno);
+    
+    double promedioGeneral = sistema.calcularPromedioGeneral();
+    cout << "\n--- ANÁLISIS COMPARATIVO ---" << endl;
+    cout << "Promedio General del Grupo: " << fixed << setprecision(2) 
+         << promedioGeneral << endl;
+    
+    double diferencia = alumno.calificacionFinal - promedioGeneral;
+    if (diferencia > 0.01) {
+        cout << "El alumno está ARRIBA del promedio general (+" 
+             << fixed << setprecision(2) << diferencia << " puntos)." << endl;
+    } else if (diferencia < -0.01) {
+        cout << "El alumno está ABAJO del promedio general (" 
+             << fixed << setprecision(2) << diferencia << " puntos)." << endl;
+    } else {
+        cout << "El alumno está EN el promedio general." << endl;
+    }
+}
+
+
+// Imprime los alumnos de un listado con la calificación de `columna`;
+// devuelve cuántos imprimió.
+int imprimirListado(const SistemaAdministrativo& sistema, const vector<int>& posiciones, int columna) {
+    for (size_t i = 0; i < posiciones.size(); i++) {
+        FichaAlumno alumno = sistema.fichaDe(posiciones[i]);
+        cout << "\n" << (i + 1) << ". " << alumno.nombre 
+             << " (Matrícula: " << alumno.matricula << ")" << endl;
+        if (columna == 0) {
+            cout << "   Calificación Final: ";
+        } else {
+            cout << "   Calificación Parcial " << columna << ": ";
         }
-        
-        mostrarAlumno(indice);
+        cout << fixed << setprecision(2) << sistema.calificacionEn(posiciones[i], columna) << endl;
+    }
+    return static_cast<int>(posiciones.size());
+}
+
+
+void listarAprobados(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    cout << "\n=== ALUMNOS APROBADOS ===" << endl;
+    int total = imprimirListado(sistema, sistema.alumnosAprobados(), 0);
     
-    void modificarAlumno() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        string matricula;
-        cout << "\n=== MODIFICAR ALUMNO ===" << endl;
-        cout << "Ingrese la matrícula del alumno a modificar: ";
-        cin >> matricula;
-        
-        int indice = buscarIndice(matricula);
-        if (indice == -1) {
-            cout << "Alumno no encontrado." << endl;
-            return;
-        }
-        
-        cout << "\nDatos actuales:" << endl;
-        mostrarAlumno(indice);
-        
-        int opcion;
-        cout << "\n¿Qué desea modificar?" << endl;
-        cout << "1. Nombre" << endl;
-        cout << "2. Matrícula" << endl;
-        cout << "3. Calificaciones" << endl;
-        cout << "4. Todo" << endl;
-        cout << "5. Cancelar" << endl;
-        cout << "Opción: ";
-        
-        if (!(cin >> opcion)) {
-            limpiarBuffer();
-            cout << "Error: Entrada inválida." << endl;
-            return;
-        }
-        
-        limpiarBuffer();
-        
-        switch (opcion) {
-            case 1: {
-                cout << "Nuevo nombre: ";
-                string nuevoNombre;
-                getline(cin, nuevoNombre);
-                if (validarCadenaNoVacia(nuevoNombre, "Nombre")) {
-                    alumnos[indice].nombre = nuevoNombre;
-                    cout << "\nAlumno modificado exitosamente." << endl;
-                }
-                break;
-            }
-            case 2: {
-                string nuevaMatricula;
-                cout << "Nueva matrícula: ";
-                getline(cin, nuevaMatricula);
-                if (!validarCadenaNoVacia(nuevaMatricula, "Matrícula")) {
-                    return;
-                }
-                if (buscarIndice(nuevaMatricula) != -1 && nuevaMatricula != matricula) {
-                    cout << "Error: Ya existe un alumno con esa matrícula." << endl;
-                    return;
-                }
-                alumnos[indice].matricula = nuevaMatricula;
-                cout << "\nAlumno modificado exitosamente." << endl;
-                break;
-            }
-            case 3: {
-                double cal1, cal2, cal3;
-                if (leerCalificacion(cal1, "Nueva calificación parcial 1: ")) {
-                    if (leerCalificacion(cal2, "Nueva calificación parcial 2: ")) {
-                        if (leerCalificacion(cal3, "Nueva calificación parcial 3: ")) {
-                            alumnos[indice].calificacion1 = cal1;
-                            alumnos[indice].calificacion2 = cal2;
-                            alumnos[indice].calificacion3 = cal3;
-                            alumnos[indice].calcularCalificacionFinal();
-                            cout << "\n Alumno modificado exitosamente." << endl;
-                        }
-                    }
-                }
-                break;
-            }
-            case 4: {
-                cout << "Nuevo nombre: ";
-                string nuevoNombre;
-                getline(cin, nuevoNombre);
-                if (!validarCadenaNoVacia(nuevoNombre, "Nombre")) {
-                    return;
-                }
-                
-                string nuevaMatricula;
-                cout << "Nueva matrícula: ";
-                getline(cin, nuevaMatricula);
-                if (!validarCadenaNoVacia(nuevaMatricula, "Matrícula")) {
-                    return;
-                }
-                
-                if (buscarIndice(nuevaMatricula) != -1 && nuevaMatricula != matricula) {
-                    cout << "Error: Ya existe un alumno con esa matrícula." << endl;
-                    return;
-                }
-                
-                double cal1, cal2, cal3;
-                if (leerCalificacion(cal1, "Nueva calificación parcial 1: ")) {
-                    if (leerCalificacion(cal2, "Nueva calificación parcial 2: ")) {
-                        if (leerCalificacion(cal3, "Nueva calificación parcial 3: ")) {
-                            alumnos[indice].nombre = nuevoNombre;
-                            alumnos[indice].matricula = nuevaMatricula;
-                            alumnos[indice].calificacion1 = cal1;
-                            alumnos[indice].calificacion2 = cal2;
-                            alumnos[indice].calificacion3 = cal3;
-                            alumnos[indice].calcularCalificacionFinal();
-                            cout << "\n Alumno modificado exitosamente." << endl;
-                        }
-                    }
-                }
-                break;
-            }
-            case 5:
-                cout << "Operación cancelada." << endl;
-                break;
-            default:
-                cout << "Opción inválida." << endl;
-                return;
-        }
+    if (total == 0) {
+        cout << "No hay alumnos aprobados." << endl;
+    } else {
+        cout << "\nTotal: " << total << " alumno(s) aprobado(s)." << endl;
+    }
+}
+
+
+void listarReprobados(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    cout << "\n=== ALUMNOS REPROBADOS ===" << endl;
+    int total = imprimirListado(sistema, sistema.alumnosReprobados(), 0);
     
-    void eliminarAlumno() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        string matricula;
-        cout << "\n=== ELIMINAR ALUMNO ===" << endl;
-        cout << "Ingrese la matrícula del alumno a eliminar: ";
-        cin >> matricula;
-        
-        int indice = buscarIndice(matricula);
-        if (indice == -1) {
-            cout << " Alumno no encontrado." << endl;
-            return;
-        }
-        
-        cout << "\nEstá seguro de eliminar a " << alumnos[indice].nombre 
-             << " (Matrícula: " << alumnos[indice].matricula << ")? (s/n): ";
-        char confirmacion;
-        cin >> confirmacion;
+    if (total == 0) {
+        cout << "No hay alumnos reprobados." << endl;
+    } else {
+        cout << "\nTotal: " << total << " alumno(s) reprobado(s)." << endl;
+    }
+}
+
+
+// Pide la columna de calificaciones: 0 es la final y 1 a 3 los parciales.
+bool leerColumnaCalificacion(int& columna) {
+    cout << "1. Calificación final" << endl;
+    cout << "2. Parcial 1" << endl;
+    cout << "3. Parcial 2" << endl;
+    cout << "4. Parcial 3" << endl;
+    cout << "Opción: ";
+    if (!(cin >> columna) || columna < 1 || columna > 4) {
         limpiarBuffer();
-        
-        if (confirmacion == 's' || confirmacion == 'S') {
-            
-            for (int i = indice; i < cantidadAlumnos - 1; i++) {
-                alumnos[i] = alumnos[i + 1];
-            }
-            cantidadAlumnos--;
-            cout << "\nAlumno eliminado exitosamente." << endl;
-        } else {
-            cout << "Operación cancelada." << endl;
-        }
+        cout << "Opción inválida." << endl;
+        return false;
+    }
+    columna--;
+    return true;
+}
+
+
+void listarPorRango(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    int columna;
+    cout << "\n=== ALUMNOS POR RANGO DE CALIFICACIÓN ===" << endl;
+    if (!leerColumnaCalificacion(columna)) return;
     
-    void mostrarAlumno(int indice) const {
-        if (indice < 0 || indice >= cantidadAlumnos) return;
-        
-        cout << "\n" << string(40, '-') << endl;
-        cout << "   INFORMACIÓN DEL ALUMNO" << endl;
-        cout << string(40, '-') << endl;
-        cout << left << setw(15) << "Nombre:" << alumnos[indice].nombre << endl;
-        cout << setw(15) << "Matrícula:" << alumnos[indice].matricula << endl;
-        cout << setw(15) << "Parcial 1:" << fixed << setprecision(2) 
-             << alumnos[indice].calificacion1 << endl;
-        cout << setw(15) << "Parcial 2:" << alumnos[indice].calificacion2 << endl;
-        cout << setw(15) << "Parcial 3:" << alumnos[indice].calificacion3 << endl;
-        cout << setw(15) << "Calificación Final:" << alumnos[indice].calificacionFinal << endl;
-        cout << setw(15) << "Estado:" 
-             << (alumnos[indice].estaAprobado() ? "APROBADO" : "REPROBADO") << endl;
-        cout << string(40, '-') << endl;
-    }
-    
-    
-    double calcularPromedioGeneral() const {
-        if (cantidadAlumnos == 0) return 0.0;
-        
-        double suma = 0.0;
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            suma += alumnos[i].calificacionFinal;
-        }
-        return round((suma / cantidadAlumnos) * 100.0) / 100.0;
+    double minimo, maximo;
+    if (!leerCalificacion(minimo, "Calificación mínima: ")) return;
+    if (!leerCalificacion(maximo, "Calificación máxima: ")) return;
+    if (minimo > maximo) {
+        cout << "Error: La calificación mínima no puede ser mayor que la máxima." << endl;
+        return;
     }
     
+    vector<int> posiciones = sistema.alumnosEnRango(columna, minimo, maximo);
+    cout << "\n--- De " << fixed << setprecision(2) << minimo << " a " << maximo << " ---" << endl;
+    int total = imprimirListado(sistema, posiciones, columna);
     
-    double calcularDesviacionEstandar() const {
-        if (cantidadAlumnos == 0) return 0.0;
-        
-        double promedio = calcularPromedioGeneral();
-        double sumaCuadrados = 0.0;
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            double diferencia = alumnos[i].calificacionFinal - promedio;
-            sumaCuadrados += diferencia * diferencia;
-        }
-        
-        double varianza = sumaCuadrados / cantidadAlumnos;
-        return round(sqrt(varianza) * 100.0) / 100.0;
+    if (total == 0) {
+        cout << "No hay alumnos en ese rango." << endl;
+    } else {
+        cout << "\nTotal: " << total << " alumno(s) en el rango." << endl;
+    }
+}
+
+
+void mostrarDistribucion(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    int columna, intervalos;
+    cout << "\n=== DISTRIBUCIÓN DE CALIFICACIONES ===" << endl;
+    if (!leerColumnaCalificacion(columna)) return;
+    cout << "Número de intervalos del histograma (1-" << INTERVALOS_MAXIMOS_HISTOGRAMA << "): ";
+    if (!(cin >> intervalos) || intervalos < 1 || intervalos > INTERVALOS_MAXIMOS_HISTOGRAMA) {
+        limpiarBuffer();
+        cout << "Error: Número de intervalos inválido." << endl;
+        return;
+    }
     
-    void buscarYAnalizar() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        string matricula;
-        cout << "\n=== BÚSQUEDA Y ANÁLISIS ===" << endl;
-        cout << "Ingrese la matrícula: ";
-        cin >> matricula;
-        
-        int indice = buscarIndice(matricula);
-        if (indice == -1) {
-            cout << " Alumno no encontrado." << endl;
-            return;
-        }
-        
-        mostrarAlumno(indice);
-        
-        double promedioGeneral = calcularPromedioGeneral();
-        cout << "\n--- ANÁLISIS COMPARATIVO ---" << endl;
-        cout << "Promedio General del Grupo: " << fixed << setprecision(2) 
-             << promedioGeneral << endl;
-        
-        double diferencia = alumnos[indice].calificacionFinal - promedioGeneral;
-        if (diferencia > 0.01) {
-            cout << "El alumno está ARRIBA del promedio general (+" 
-                 << fixed << setprecision(2) << diferencia << " puntos)." << endl;
-        } else if (diferencia < -0.01) {
-            cout << "El alumno está ABAJO del promedio general (" 
-                 << fixed << setprecision(2) << diferencia << " puntos)." << endl;
-        } else {
-            cout << "El alumno está EN el promedio general." << endl;
-        }
+    const DistribucionCalificaciones& datos = sistema.distribucion(columna);
+    cout << fixed << setprecision(2);
+    cout << "\nMínimo: " << datos.kEsimo(1) / 100.0 << endl;
+    cout << "Percentil 10: " << datos.percentil(10) << endl;
+    cout << "Primer Cuartil: " << datos.percentil(25) << endl;
+    cout << "Mediana: " << datos.percentil(50) << endl;
+    cout << "Tercer Cuartil: " << datos.percentil(75) << endl;
+    cout << "Percentil 90: " << datos.percentil(90) << endl;
+    cout << "Máximo: " << datos.kEsimo(datos.tamano()) / 100.0 << endl;
+    
+    vector<size_t> histograma = datos.histograma(intervalos);
+    size_t mayor = *max_element(histograma.begin(), histograma.end());
+    cout << "\nHistograma:" << endl;
+    for (int i = 0; i < intervalos; i++) {
+        double desde = DistribucionCalificaciones::limiteIntervalo(i, intervalos) / 100.0;
+        double hasta = i + 1 == intervalos ? CALIFICACION_MAX
+                     : (DistribucionCalificaciones::limiteIntervalo(i + 1, intervalos) - 1) / 100.0;
+        int barra = mayor > 0 ? static_cast<int>(histograma[i] * 40 / mayor) : 0;
+        cout << setw(6) << desde << " - " << setw(6) << hasta << " | " << string(barra, '#') 
+             << ' ' << histograma[i] << endl;
+    }
+}
+
+
+void mostrarInstrumentacion() {
+    cout << "\n=== CONTADORES DE RENDIMIENTO ===" << endl;
+    if (!INSTRUMENTACION_HABILITADA) {
+        cout << "La instrumentación no está disponible; compile con -DSISTEMA_INSTRUMENTACION." << endl;
+        return;
     }
     
+    const char* contadores[] = {"Líneas analizadas", "Líneas rechazadas", "Búsquedas por matrícula",
+                                "Comparaciones de matrícula", "Redimensionamientos", "Bytes leídos",
+                                "Bytes escritos"};
+    for (int i = 0; i < static_cast<int>(Contador::TOTAL); i++) {
+        cout << contadores[i] << ": " << Instrumentacion::valor(static_cast<Contador>(i)) << endl;
+    }
     
-    void listarAprobados() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        cout << "\n=== ALUMNOS APROBADOS ===" << endl;
-        bool hayAprobados = false;
-        int contador = 1;
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            if (alumnos[i].estaAprobado()) {
-                hayAprobados = true;
-                cout << "\n" << contador++ << ". " << alumnos[i].nombre 
-                     << " (Matrícula: " << alumnos[i].matricula << ")" << endl;
-                cout << "   Calificación Final: " << fixed << setprecision(2) 
-                     << alumnos[i].calificacionFinal << endl;
-            }
-        }
-        
-        if (!hayAprobados) {
-            cout << "No hay alumnos aprobados." << endl;
-        } else {
-            cout << "\nTotal: " << (contador - 1) << " alumno(s) aprobado(s)." << endl;
-        }
+    const char* temporizadores[] = {"Carga", "Análisis de líneas", "Verificación de duplicados",
+                                    "Redimensionamiento", "Guardado", "Reporte", "Escritura a disco"};
+    cout << "\nTiempos acumulados:" << endl;
+    cout << fixed << setprecision(3);
+    for (int i = 0; i < static_cast<int>(Temporizador::TOTAL); i++) {
+        Temporizador temporizador = static_cast<Temporizador>(i);
+        cout << temporizadores[i] << ": " << Instrumentacion::milisegundos(temporizador) << " ms en " 
+             << Instrumentacion::llamadas(temporizador) << " llamada(s)" << endl;
+    }
+}
+
+
+void volcarInstrumentacion() {
+    Instrumentacion::volcar(cerr);
+}
+
+
+void generarReporteGeneral(const SistemaAdministrativo& sistema, int hilos) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados para generar el reporte." << endl;
+        return;
     }
     
+    int opcion;
+    cout << "\nFormato del reporte:" << endl;
+    cout << "1. Texto (reporte.txt)" << endl;
+    cout << "2. CSV (reporte.csv)" << endl;
+    cout << "3. JSON Lines (reporte.jsonl)" << endl;
+    cout << "4. Columnar binario (reporte.col)" << endl;
+    cout << "Opción: ";
+    if (!(cin >> opcion) || opcion < 1 || opcion > 4) {
+        limpiarBuffer();
+        cout << "Opción inválida." << endl;
+        return;
+    }
     
-    void listarReprobados() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        cout << "\n=== ALUMNOS REPROBADOS ===" << endl;
-        bool hayReprobados = false;
-        int contador = 1;
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            if (!alumnos[i].estaAprobado()) {
-                hayReprobados = true;
-                cout << "\n" << contador++ << ". " << alumnos[i].nombre 
-                     << " (Matrícula: " << alumnos[i].matricula << ")" << endl;
-                cout << "   Calificación Final: " << fixed << setprecision(2) 
-                     << alumnos[i].calificacionFinal << endl;
-            }
-        }
-        
-        if (!hayReprobados) {
-            cout << "No hay alumnos reprobados." << endl;
-        } else {
-            cout << "\nTotal: " << (contador - 1) << " alumno(s) reprobado(s)." << endl;
-        }
+    const FormatoReporte formatos[] = {FormatoReporte::TEXTO, FormatoReporte::CSV, 
+                                       FormatoReporte::JSONL, FormatoReporte::COLUMNAR};
+    FormatoReporte formato = formatos[opcion - 1];
+    if (sistema.escribirReporte(archivoReportePorOmision(formato), formato, hilos)) {
+        cout << "\nReporte generado exitosamente en " << archivoReportePorOmision(formato) << endl;
+    } else {
+        cerr << "Advertencia: Puede haber ocurrido un error al escribir el archivo." << endl;
+    }
+}
+
+
+void mostrarExtremos(SistemaAdministrativo& sistema, size_t k, bool mejores) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    vector<int> posiciones = sistema.extremosCalificacion(k, mejores);
     
-    void generarReporteGeneral() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados para generar el reporte." << endl;
-            return;
-        }
-        
-        ofstream archivo("reporte.txt");
-        if (!archivo.is_open()) {
-            cerr << "Error: No se pudo crear el archivo reporte.txt" << endl;
-            return;
-        }
-        
-        archivo << string(50, '=') << endl;
-        archivo << "     REPORTE GENERAL DE ALUMNOS" << endl;
-        archivo << string(50, '=') << endl << endl;
-        
-        archivo << "Fecha de generación: " << __DATE__ << " " << __TIME__ << endl;
-        archivo << "Total de Alumnos: " << cantidadAlumnos << endl << endl;
-        
-        archivo << string(50, '-') << endl;
-        archivo << "INFORMACIÓN DE ALUMNOS" << endl;
-        archivo << string(50, '-') << endl;
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            archivo << "\nAlumno " << (i + 1) << ":" << endl;
-            archivo << "  Nombre: " << alumnos[i].nombre << endl;
-            archivo << "  Matrícula: " << alumnos[i].matricula << endl;
-            archivo << "  Calificación Parcial 1: " << fixed << setprecision(2) 
-                    << alumnos[i].calificacion1 << endl;
-            archivo << "  Calificación Parcial 2: " << alumnos[i].calificacion2 << endl;
-            archivo << "  Calificación Parcial 3: " << alumnos[i].calificacion3 << endl;
-            archivo << "  Calificación Final: " << alumnos[i].calificacionFinal << endl;
-            archivo << "  Estado: " << (alumnos[i].estaAprobado() ? "APROBADO" : "REPROBADO") << endl;
-        }
-        
-        archivo << "\n" << string(50, '-') << endl;
-        archivo << "ESTADÍSTICAS GENERALES" << endl;
-        archivo << string(50, '-') << endl;
-        
-        double promedio = calcularPromedioGeneral();
-        double desviacion = calcularDesviacionEstandar();
-        
-        archivo << "Promedio General: " << fixed << setprecision(2) << promedio << endl;
-        archivo << "Desviación Estándar: " << desviacion << endl;
-        
-        
-        int aprobados = 0, reprobados = 0;
-        double calMax = 0, calMin = 100;
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            if (alumnos[i].estaAprobado()) aprobados++;
-            else reprobados++;
-            
-            if (alumnos[i].calificacionFinal > calMax) calMax = alumnos[i].calificacionFinal;
-            if (alumnos[i].calificacionFinal < calMin) calMin = alumnos[i].calificacionFinal;
-        }
-        
-        archivo << "Alumnos Aprobados: " << aprobados << " (" 
-                << fixed << setprecision(1) 
-                << (aprobados * 100.0 / cantidadAlumnos) << "%)" << endl;
-        archivo << "Alumnos Reprobados: " << reprobados << " (" 
-                << (reprobados * 100.0 / cantidadAlumnos) << "%)" << endl;
-        archivo << "Calificación Máxima: " << fixed << setprecision(2) << calMax << endl;
-        archivo << "Calificación Mínima: " << calMin << endl;
-        
-        archivo << "\n" << string(50, '=') << endl;
-        
-        archivo.close();
-        
-        if (archivo.good() || archivo.eof()) {
-            cout << "\nReporte generado exitosamente en reporte.txt" << endl;
-        } else {
-            cerr << "Advertencia: Puede haber ocurrido un error al escribir el archivo." << endl;
-        }
+    if (mejores) {
+        cout << "\n=== TOP " << k << " MEJORES CALIFICACIONES ===" << endl;
+    } else {
+        cout << "\n=== " << k << " PEORES CALIFICACIONES ===" << endl;
     }
     
-    
-    void top3MejoresCalificaciones() {
-        if (cantidadAlumnos == 0) {
-            cout << "\nNo hay alumnos registrados." << endl;
-            return;
-        }
-        
-        
-        Alumno* copia = new (nothrow) Alumno[cantidadAlumnos];
-        if (!copia) {
-            cerr << "Error: No se pudo asignar memoria." << endl;
-            return;
-        }
-        
-        for (int i = 0; i < cantidadAlumnos; i++) {
-            copia[i] = alumnos[i];
-        }
-        
-        
-        bool intercambio;
-        for (int i = 0; i < cantidadAlumnos - 1; i++) {
-            intercambio = false;
-            for (int j = 0; j < cantidadAlumnos - i - 1; j++) {
-                if (copia[j].calificacionFinal < copia[j + 1].calificacionFinal) {
-                    Alumno temp = copia[j];
-                    copia[j] = copia[j + 1];
-                    copia[j + 1] = temp;
-                    intercambio = true;
-                }
-            }
-            if (!intercambio) break; 
-        }
-        
-        cout << "\n=== TOP 3 MEJORES CALIFICACIONES ===" << endl;
-        int mostrar = min(3, cantidadAlumnos);
-        
-        for (int i = 0; i < mostrar; i++) {
-            cout << "\n" << (i + 1) << ". " << copia[i].nombre 
-                 << " (Matrícula: " << copia[i].matricula << ")" << endl;
-            cout << "   Calificación Final: " << fixed << setprecision(2) 
-                 << copia[i].calificacionFinal << endl;
-        }
-        
-        delete[] copia;
+    for (size_t i = 0; i < posiciones.size(); i++) {
+        FichaAlumno alumno = sistema.fichaDe(posiciones[i]);
+        cout << "\n" << (i + 1) << ". " << alumno.nombre 
+             << " (Matrícula: " << alumno.matricula << ")" << endl;
+        cout << "   Calificación Final: " << fixed << setprecision(2) 
+             << alumno.calificacionFinal << endl;
+    }
+}
+
+
+void top3MejoresCalificaciones(SistemaAdministrativo& sistema) {
+    mostrarExtremos(sistema, 3, true);
+}
+
+
+void rankingCalificaciones(SistemaAdministrativo& sistema) {
+    if (sistema.getCantidadAlumnos() == 0) {
+        cout << "\nNo hay alumnos registrados." << endl;
+        return;
     }
     
+    int cantidad, tipo;
+    cout << "\n=== MEJORES O PEORES CALIFICACIONES ===" << endl;
+    cout << "Cantidad de alumnos a mostrar: ";
+    if (!(cin >> cantidad) || cantidad < 1) {
+        limpiarBuffer();
+        cout << "Error: Debe ingresar un número entero positivo." << endl;
+        return;
+    }
     
-    int getCantidadAlumnos() const {
-        return cantidadAlumnos;
+    cout << "1. Mejores" << endl;
+    cout << "2. Peores" << endl;
+    cout << "Opción: ";
+    if (!(cin >> tipo) || (tipo != 1 && tipo != 2)) {
+        limpiarBuffer();
+        cout << "Opción inválida." << endl;
+        return;
     }
-};
+    
+    mostrarExtremos(sistema, static_cast<size_t>(cantidad), tipo == 1);
+}
 
 
 bool leerOpcion(int& opcion, int min, int max) {
@@ -868,7 +667,8 @@ void mostrarMenuAlumnos() {
     cout << "2. Leer Alumno" << endl;
     cout << "3. Modificar Alumno" << endl;
     cout << "4. Eliminar Alumno" << endl;
-    cout << "5. Volver al Menú Principal" << endl;
+    cout << "5. Buscar Alumno por Nombre" << endl;
+    cout << "6. Volver al Menú Principal" << endl;
     cout << string(40, '-') << endl;
     cout << "Seleccione una opción: ";
 }
@@ -883,27 +683,310 @@ void mostrarMenuReportes() {
     cout << "3. Listar Alumnos Reprobados" << endl;
     cout << "4. Generar Reporte General" << endl;
     cout << "5. Top 3 Mejores Calificaciones" << endl;
-    cout << "6. Volver al Menú Principal" << endl;
+    cout << "6. Mejores o Peores K Calificaciones" << endl;
+    cout << "7. Alumnos por Rango de Calificación" << endl;
+    cout << "8. Distribución de Calificaciones" << endl;
+    cout << "9. Contadores de Rendimiento" << endl;
+    cout << "10. Volver al Menú Principal" << endl;
     cout << string(40, '-') << endl;
     cout << "Seleccione una opción: ";
 }
 
-int main() {
+struct OpcionesLinea {
+    int hilos;
+    string importar;
+    string exportar;
+    bool ranking;
+    ModoBaja modoBaja;
+    string lote;
+    bool estricto;
+    string fusionar;
+    string reporte;
+    bool instrumentacion;
+    
+    OpcionesLinea() : hilos(1), ranking(false), modoBaja(ModoBaja::LAPIDA), estricto(false), 
+                      instrumentacion(false) {}
+};
+
+
+bool leerOpcionesLinea(int argc, char* argv[], OpcionesLinea& opciones) {
+    for (int i = 1; i < argc; i++) {
+        string argumento = argv[i];
+        if (argumento == "--threads" && i + 1 < argc) {
+            try {
+                opciones.hilos = stoi(argv[++i]);
+            } catch (const exception&) {
+                opciones.hilos = 0;
+            }
+            if (opciones.hilos < 1) {
+                cerr << "Error: --threads requiere un número entero positivo." << endl;
+                return false;
+            }
+        } else if (argumento == "--importar" && i + 1 < argc) {
+            opciones.importar = argv[++i];
+        } else if (argumento == "--exportar" && i + 1 < argc) {
+            opciones.exportar = argv[++i];
+        } else if (argumento == "--ranking") {
+            opciones.ranking = true;
+        } else if (argumento == "--baja" && i + 1 < argc) {
+            string modo = argv[++i];
+            if (modo == "lapida") {
+                opciones.modoBaja = ModoBaja::LAPIDA;
+            } else if (modo == "intercambio") {
+                opciones.modoBaja = ModoBaja::INTERCAMBIO;
+            } else {
+                cerr << "Error: --baja acepta 'lapida' o 'intercambio'." << endl;
+                return false;
+            }
+        } else if (argumento == "--lote" && i + 1 < argc) {
+            opciones.lote = argv[++i];
+        } else if (argumento == "--estricto") {
+            opciones.estricto = true;
+        } else if (argumento == "--fusionar" && i + 1 < argc) {
+            opciones.fusionar = argv[++i];
+        } else if (argumento == "--reporte" && i + 1 < argc) {
+            opciones.reporte = argv[++i];
+            FormatoReporte formato;
+            if (!formatoDesdeNombre(opciones.reporte, formato)) {
+                cerr << "Error: --reporte acepta 'texto', 'csv', 'jsonl' o 'columnar'." << endl;
+                return false;
+            }
+        } else if (argumento == "--instrumentacion") {
+            opciones.instrumentacion = true;
+        } else {
+            cerr << "Uso: " << argv[0] 
+                 << " [--threads N] [--importar archivo.txt] [--exportar archivo.txt] [--ranking]" 
+                 << " [--baja lapida|intercambio] [--lote archivo|-] [--estricto]" 
+                 << " [--fusionar actualizaciones.txt] [--reporte texto|csv|jsonl|columnar]"
+                 << " [--instrumentacion]" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool compactar(SistemaAdministrativo& sistema, Bitacora& bitacora) {
+    sistema.compactarRegistro();
+    sistema.compactarCadenas();
+    if (!sistema.guardarBinario(ARCHIVO_BINARIO)) {
+        return false;
+    }
+    return !bitacora.abierta() || bitacora.vaciar();
+}
+
+
+// Recoge el resultado de las instantáneas que terminó de escribir el hilo
+// de guardado. La bitácora sólo se vacía si la instantánea ya incluye todos
+// sus registros; si hubo cambios mientras se escribía, se conservan hasta la
+// siguiente.
+bool atenderGuardado(Bitacora& bitacora, GuardadoSegundoPlano& guardado) {
+    EstadoGuardado estado = guardado.consultar();
+    if (estado.guardada && bitacora.abierta() && bitacora.cantidadRegistros() > 0 &&
+        bitacora.ultimaSecuencia() <= estado.secuencia && !bitacora.vaciar()) {
+        return false;
+    }
+    return !estado.fallo;
+}
+
+
+// Con la bitácora abierta cada cambio ya quedó registrado al aplicarse; la
+// instantánea sólo se reescribe cuando la bitácora crece en proporción al
+// registro, así el costo por cambio no depende de la cantidad de alumnos.
+// La instantánea se escribe en segundo plano: aquí sólo se copia a memoria.
+bool guardarCambios(SistemaAdministrativo& sistema, Bitacora& bitacora, GuardadoSegundoPlano& guardado) {
+    bool correcto = atenderGuardado(bitacora, guardado);
+    if (!bitacora.abierta()) {
+        guardado.enviar(ARCHIVO_BINARIO, sistema.instantaneaBinaria(), sistema.getSecuencia());
+        return correcto;
+    }
+    
+    size_t umbral = max(CAMBIOS_MINIMOS_COMPACTACION, static_cast<size_t>(sistema.getCantidadAlumnos() / 4));
+    if (bitacora.cantidadRegistros() >= umbral && !guardado.ocupado()) {
+        sistema.compactarRegistro();
+        sistema.compactarCadenas();
+        guardado.enviar(ARCHIVO_BINARIO, sistema.instantaneaBinaria(), sistema.getSecuencia());
+    }
+    return correcto;
+}
+
+
+// Como en el modo por lotes, los cambios de la fusión se guardan juntos en
+// una instantánea en lugar de registrarse uno por uno en la bitácora.
+int fusionarArchivo(SistemaAdministrativo& sistema, Bitacora& bitacora, const OpcionesLinea& opciones, 
+                    bool importado) {
+    sistema.asignarBitacora(nullptr);
+    ResultadoFusion resultado = sistema.fusionarCalificaciones(opciones.fusionar);
+    if (!resultado.leido) {
+        cerr << "Error: No se pudo abrir " << opciones.fusionar << "." << endl;
+        return 1;
+    }
+    
+    cout << "Insertados: " << resultado.insertados << endl;
+    cout << "Actualizados: " << resultado.actualizados << endl;
+    cout << "Sin cambios: " << resultado.sinCambios << endl;
+    cout << "Rechazados: " << resultado.rechazados << endl;
+    
+    bool hayCambios = resultado.insertados + resultado.actualizados > 0 || importado;
+    if (hayCambios && !compactar(sistema, bitacora)) {
+        cerr << "Error al guardar los datos fusionados." << endl;
+        return 1;
+    }
+    return 0;
+}
+
+
+// Modo por lotes: los cambios no pasan uno por uno por la bitácora; al
+// terminar se guardan todos juntos en una sola instantánea. Si el lote se
+// interrumpe (--estricto) no se guarda nada y el registro en disco queda
+// como estaba.
+int ejecutarModoLote(SistemaAdministrativo& sistema, Bitacora& bitacora, const OpcionesLinea& opciones, 
+                     bool importado) {
+    ifstream archivo;
+    if (opciones.lote != "-") {
+        archivo.open(opciones.lote);
+        if (!archivo.is_open()) {
+            cerr << "Error: No se pudo abrir " << opciones.lote << "." << endl;
+            return 1;
+        }
+    }
+    istream& entrada = opciones.lote == "-" ? cin : archivo;
+    
+    sistema.asignarBitacora(nullptr);
+    ResultadoLote resultado = sistema.ejecutarLote(entrada, cout, opciones.estricto);
+    
+    const char* estado = "sin cambios";
+    bool guardado = true;
+    if (resultado.interrumpido) {
+        estado = "descartado";
+    } else if (resultado.cambios > 0 || importado) {
+        guardado = compactar(sistema, bitacora);
+        estado = guardado ? "guardado" : "error al guardar";
+    }
+    cout << "resumen|" << resultado.comandos << '|' << resultado.cambios << '|' 
+         << resultado.errores << '|' << estado << endl;
+    return guardado && resultado.errores == 0 ? 0 : 1;
+}
+
+
+int main(int argc, char* argv[]) {
+    OpcionesLinea opciones;
+    if (!leerOpcionesLinea(argc, argv, opciones)) {
+        return 1;
+    }
+    
+    // Los contadores se vuelcan a la salida de errores al terminar, por
+    // cualquiera de las salidas del programa.
+    if (opciones.instrumentacion) {
+        if (INSTRUMENTACION_HABILITADA) {
+            atexit(volcarInstrumentacion);
+        } else {
+            cerr << "Advertencia: --instrumentacion requiere compilar con -DSISTEMA_INSTRUMENTACION." << endl;
+        }
+    }
+    
+    // En modo por lotes la salida estándar lleva sólo los resultados; los
+    // mensajes de inicio van a la salida de errores.
+    bool modoLote = !opciones.lote.empty();
+    if (modoLote) {
+        ios::sync_with_stdio(false);
+        cin.tie(nullptr);
+    }
+    ostream& avisos = modoLote ? cerr : cout;
+    
     SistemaAdministrativo sistema;
+    sistema.mantenerRanking(opciones.ranking);
+    sistema.asignarModoBaja(opciones.modoBaja);
     
     
-    cout << "\n" << string(50, '=') << endl;
-    cout << "   INICIALIZANDO SISTEMA" << endl;
-    cout << string(50, '=') << endl;
-    cout << "Cargando datos desde alumnos.txt..." << endl;
+    avisos << "\n" << string(50, '=') << endl;
+    avisos << "   INICIALIZANDO SISTEMA" << endl;
+    avisos << string(50, '=') << endl;
+    
+    bool cargado;
+    if (!opciones.importar.empty()) {
+        avisos << "Importando datos desde " << opciones.importar << "..." << endl;
+        cargado = sistema.cargarDesdeArchivo(opciones.importar, opciones.hilos);
+    } else {
+        avisos << "Cargando datos desde " << ARCHIVO_BINARIO << "..." << endl;
+        cargado = sistema.cargarBinario(ARCHIVO_BINARIO);
+        if (!cargado) {
+            avisos << "Importando datos desde " << ARCHIVO_TEXTO << "..." << endl;
+            cargado = sistema.cargarDesdeArchivo(ARCHIVO_TEXTO, opciones.hilos);
+        }
+    }
+    
+    // Una importación fallida termina aquí: seguir con el registro vacío
+    // haría que el primer guardado reemplazara alumnos.bin y vaciara la
+    // bitácora.
+    if (!opciones.importar.empty() && !cargado) {
+        cerr << "Error: No se pudo importar " << opciones.importar 
+             << "; no se modificó " << ARCHIVO_BINARIO << "." << endl;
+        return 1;
+    }
+    bool importado = !opciones.importar.empty() && cargado;
     
-    if (sistema.cargarDesdeArchivo("alumnos.txt")) {
-        cout << "Datos cargados exitosamente. (" 
-             << sistema.getCantidadAlumnos() << " alumno(s) registrado(s))" << endl;
+    if (cargado) {
+        avisos << "Datos cargados exitosamente. (" 
+               << sistema.getCantidadAlumnos() << " alumno(s) registrado(s))" << endl;
     } else {
-        cout << "No se encontró el archivo alumnos.txt. Se creará uno nuevo al guardar." << endl;
+        avisos << "No se encontraron datos. Se creará " << ARCHIVO_BINARIO << " al guardar." << endl;
     }
     
+    Bitacora bitacora;
+    if (bitacora.abrir(ARCHIVO_BITACORA)) {
+        if (opciones.importar.empty()) {
+            int aplicados = 0;
+            bitacora.reproducir([&sistema, &aplicados](const CambioBitacora& cambio) {
+                if (sistema.aplicarCambio(cambio)) aplicados++;
+            });
+            if (aplicados > 0) {
+                avisos << "Se aplicaron " << aplicados << " cambio(s) pendientes de " << ARCHIVO_BITACORA 
+                       << ". (" << sistema.getCantidadAlumnos() << " alumno(s) registrado(s))" << endl;
+            }
+        }
+        sistema.asignarBitacora(&bitacora);
+    } else {
+        cerr << "Advertencia: No se pudo abrir " << ARCHIVO_BITACORA 
+             << "; se guardará el registro completo después de cada cambio." << endl;
+    }
+    
+    if (!opciones.exportar.empty()) {
+        if (!sistema.guardarEnArchivo(opciones.exportar)) {
+            cerr << "Error al exportar a " << opciones.exportar << "." << endl;
+            return 1;
+        }
+        cout << "Datos exportados a " << opciones.exportar << "." << endl;
+        return 0;
+    }
+    
+    if (!opciones.reporte.empty()) {
+        FormatoReporte formato = FormatoReporte::TEXTO;
+        formatoDesdeNombre(opciones.reporte, formato);
+        if (sistema.getCantidadAlumnos() == 0 && formato == FormatoReporte::TEXTO) {
+            cerr << "No hay alumnos registrados para generar el reporte." << endl;
+            return 1;
+        }
+        if (!sistema.escribirReporte(archivoReportePorOmision(formato), formato, opciones.hilos)) {
+            return 1;
+        }
+        cout << "Reporte generado en " << archivoReportePorOmision(formato) << "." << endl;
+        return 0;
+    }
+    
+    if (!opciones.fusionar.empty()) {
+        return fusionarArchivo(sistema, bitacora, opciones, importado);
+    }
+    
+    if (modoLote) {
+        return ejecutarModoLote(sistema, bitacora, opciones, importado);
+    }
+    
+    if (importado && !compactar(sistema, bitacora)) {
+        cerr << "Error al guardar los datos importados." << endl;
+    }
+    
+    GuardadoSegundoPlano guardado;
     int opcionPrincipal, opcionModulo;
     bool salir = false;
     
@@ -920,15 +1003,15 @@ int main() {
                 do {
                     mostrarMenuAlumnos();
                     
-                    if (!leerOpcion(opcionModulo, 1, 5)) {
-                        cout << "\nOpción inválida. Por favor, ingrese un número entre 1 y 5." << endl;
+                    if (!leerOpcion(opcionModulo, 1, 6)) {
+                        cout << "\nOpción inválida. Por favor, ingrese un número entre 1 y 6." << endl;
                         continue;
                     }
                     
                     switch (opcionModulo) {
                         case 1:
-                            if (sistema.agregarAlumno()) {
-                                if (sistema.guardarEnArchivo("alumnos.txt")) {
+                            if (agregarAlumno(sistema)) {
+                                if (guardarCambios(sistema, bitacora, guardado)) {
                                     cout << "Cambios guardados en archivo." << endl;
                                 } else {
                                     cerr << "Error al guardar cambios." << endl;
@@ -936,63 +1019,79 @@ int main() {
                             }
                             break;
                         case 2:
-                            sistema.leerAlumno();
+                            leerAlumno(sistema);
                             break;
                         case 3:
-                            sistema.modificarAlumno();
-                            if (sistema.guardarEnArchivo("alumnos.txt")) {
+                            modificarAlumno(sistema);
+                            if (guardarCambios(sistema, bitacora, guardado)) {
                                 cout << "Cambios guardados en archivo." << endl;
                             } else {
                                 cerr << "Error al guardar cambios." << endl;
                             }
                             break;
                         case 4:
-                            sistema.eliminarAlumno();
-                            if (sistema.guardarEnArchivo("alumnos.txt")) {
+                            eliminarAlumno(sistema);
+                            if (guardarCambios(sistema, bitacora, guardado)) {
                                 cout << "Cambios guardados en archivo." << endl;
                             } else {
                                 cerr << "Error al guardar cambios." << endl;
                             }
                             break;
                         case 5:
+                            buscarAlumnoPorNombre(sistema);
+                            break;
+                        case 6:
                             break;
                     }
-                } while (opcionModulo != 5);
+                } while (opcionModulo != 6);
                 break;
                 
             case 2: 
                 do {
                     mostrarMenuReportes();
                     
-                    if (!leerOpcion(opcionModulo, 1, 6)) {
-                        cout << "\nOpción inválida. Por favor, ingrese un número entre 1 y 6." << endl;
+                    if (!leerOpcion(opcionModulo, 1, 10)) {
+                        cout << "\nOpción inválida. Por favor, ingrese un número entre 1 y 10." << endl;
                         continue;
                     }
                     
                     switch (opcionModulo) {
                         case 1:
-                            sistema.buscarYAnalizar();
+                            buscarYAnalizar(sistema);
                             break;
                         case 2:
-                            sistema.listarAprobados();
+                            listarAprobados(sistema);
                             break;
                         case 3:
-                            sistema.listarReprobados();
+                            listarReprobados(sistema);
                             break;
                         case 4:
-                            sistema.generarReporteGeneral();
+                            generarReporteGeneral(sistema, opciones.hilos);
                             break;
                         case 5:
-                            sistema.top3MejoresCalificaciones();
+                            top3MejoresCalificaciones(sistema);
                             break;
                         case 6:
+                            rankingCalificaciones(sistema);
+                            break;
+                        case 7:
+                            listarPorRango(sistema);
+                            break;
+                        case 8:
+                            mostrarDistribucion(sistema);
+                            break;
+                        case 9:
+                            mostrarInstrumentacion();
+                            break;
+                        case 10:
                             break;
                     }
-                } while (opcionModulo != 6);
+                } while (opcionModulo != 10);
                 break;
                 
             case 3: 
-                if (sistema.guardarEnArchivo("alumnos.txt")) {
+                guardado.esperar();
+                if (compactar(sistema, bitacora)) {
                     cout << "\nDatos guardados exitosamente." << endl;
                 } else {
                     cerr << "\nAdvertencia: Hubo un problema al guardar los datos." << endl;
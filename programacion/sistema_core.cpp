@@ -0,0 +1,1412 @@
+#include "sistema_core.h"
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <cstring>
+#include <future>
+
+#include "pool_hilos.h"
+
+using namespace std;
+
+
+const int CAPACIDAD_INICIAL = 10;
+const size_t LAPIDAS_MINIMAS_COMPACTACION = 1024;
+const size_t BYTES_MINIMOS_COMPACTACION_CADENAS = 64 * 1024;
+const int ALUMNOS_POR_PARTE_REPORTE = 4096;
+
+
+void SistemaAdministrativo::liberarAlmacenamiento() {
+    if (alumnos) {
+        for (int i = 0; i < ranurasUsadas; i++) {
+            alumnos[i].~Alumno();
+        }
+        ::operator delete(alumnos);
+        alumnos = nullptr;
+    }
+    ranurasUsadas = 0;
+}
+
+
+void SistemaAdministrativo::copiarAlumnosDe(const SistemaAdministrativo& otro) {
+    alumnos = reservarRanuras(capacidad);
+    if (!alumnos) {
+        cerr << "Error: No se pudo asignar memoria." << endl;
+        capacidad = 0;
+        vaciarRegistro();
+        return;
+    }
+    for (int i = 0; i < ranurasUsadas; i++) {
+        new (&alumnos[i]) Alumno(otro.alumnos[i]);
+        if (ocupadas[i]) {
+            alumnos[i].nombre = cadenas.guardar(alumnos[i].nombre);
+            alumnos[i].matricula = cadenas.guardar(alumnos[i].matricula);
+        }
+    }
+}
+
+
+void SistemaAdministrativo::redimensionar(int nuevaCapacidad) {
+    if (nuevaCapacidad <= capacidad) return;
+    INSTRUMENTAR_TIEMPO(REDIMENSIONAR);
+    INSTRUMENTAR_CONTAR(REDIMENSIONAMIENTOS, 1);
+    
+    Alumno* nuevo = reservarRanuras(nuevaCapacidad);
+    if (!nuevo) {
+        cerr << "Error: No se pudo asignar memoria." << endl;
+        return;
+    }
+    
+    for (int i = 0; i < ranurasUsadas; i++) {
+        new (&nuevo[i]) Alumno(std::move(alumnos[i]));
+        alumnos[i].~Alumno();
+    }
+    
+    ::operator delete(alumnos);
+    alumnos = nuevo;
+    capacidad = nuevaCapacidad;
+    ocupadas.reserve(nuevaCapacidad);
+    indiceMatriculas.reservar(nuevaCapacidad);
+    columnas.reservar(nuevaCapacidad);
+}
+
+
+int SistemaAdministrativo::buscarIndice(string_view matricula) const {
+    INSTRUMENTAR_CONTAR(BUSQUEDAS, 1);
+    return indiceMatriculas.buscar(matricula, [this](int i) {
+        INSTRUMENTAR_CONTAR(COMPARACIONES, 1);
+        return alumnos[i].matricula;
+    });
+}
+
+
+void SistemaAdministrativo::vaciarRegistro() {
+    if (alumnos) {
+        for (int i = 0; i < ranurasUsadas; i++) {
+            alumnos[i].~Alumno();
+        }
+    }
+    cantidadAlumnos = 0;
+    ranurasUsadas = 0;
+    ocupadas.clear();
+    ranurasLibres.clear();
+    indiceMatriculas.limpiar();
+    columnas.limpiar();
+    estadisticas.limpiar();
+    ranking.limpiar();
+    limpiarRangos();
+    limpiarDistribuciones();
+    indiceNombres.limpiar();
+    cadenas.limpiar();
+}
+
+
+void SistemaAdministrativo::indexarCalificaciones(int posicion) {
+    for (int c = 0; c < COLUMNAS_RANGO; c++) {
+        int centesimas = aCentesimas(columnaRango(c)[posicion]);
+        rangos[c].insertar(centesimas, posicion);
+        distribuciones[c].agregar(centesimas);
+    }
+}
+
+
+void SistemaAdministrativo::desindexarCalificaciones(int posicion) {
+    for (int c = 0; c < COLUMNAS_RANGO; c++) {
+        int centesimas = aCentesimas(columnaRango(c)[posicion]);
+        rangos[c].eliminar(centesimas, posicion);
+        distribuciones[c].quitar(centesimas);
+    }
+}
+
+
+void SistemaAdministrativo::limpiarRangos() {
+    for (int c = 0; c < COLUMNAS_RANGO; c++) {
+        rangos[c].limpiar();
+    }
+}
+
+
+void SistemaAdministrativo::limpiarDistribuciones() {
+    for (int c = 0; c < COLUMNAS_RANGO; c++) {
+        distribuciones[c].limpiar();
+    }
+}
+
+
+FichaAlumno SistemaAdministrativo::fichaDe(int posicion) const {
+    const Alumno& alumno = alumnos[posicion];
+    return FichaAlumno{string(alumno.nombre), string(alumno.matricula), alumno.calificacion1,
+                       alumno.calificacion2, alumno.calificacion3, alumno.calificacionFinal};
+}
+
+
+bool SistemaAdministrativo::asegurarRanura() {
+    if (!hayRanuraDisponible()) {
+        redimensionar(max(CAPACIDAD_INICIAL, capacidad * 2));
+    }
+    return hayRanuraDisponible();
+}
+
+
+void SistemaAdministrativo::anexarAlumno(Alumno alumno) {
+    alumno.nombre = cadenas.guardar(alumno.nombre);
+    alumno.matricula = cadenas.guardar(alumno.matricula);
+    int ranura;
+    if (!ranurasLibres.empty()) {
+        ranura = ranurasLibres.back();
+        ranurasLibres.pop_back();
+        ocupadas[ranura] = 1;
+        columnas.asignar(ranura, alumno.calificacion1, alumno.calificacion2, alumno.calificacion3,
+                         alumno.calificacionFinal);
+        alumnos[ranura] = alumno;
+    } else {
+        ranura = ranurasUsadas++;
+        ocupadas.push_back(1);
+        columnas.agregar(alumno.calificacion1, alumno.calificacion2, alumno.calificacion3,
+                         alumno.calificacionFinal);
+        new (&alumnos[ranura]) Alumno(alumno);
+    }
+    
+    const Alumno& colocado = alumnos[ranura];
+    indiceMatriculas.insertar(colocado.matricula, ranura);
+    estadisticas.agregar(aCentesimas(colocado.calificacionFinal));
+    ranking.insertar(aCentesimas(colocado.calificacionFinal), ranura);
+    indexarCalificaciones(ranura);
+    indiceNombres.insertar(colocado.nombre, ranura);
+    cantidadAlumnos++;
+}
+
+
+void SistemaAdministrativo::liberarRanura(int ranura) {
+    if (ranura == ranurasUsadas - 1) {
+        alumnos[ranura].~Alumno();
+        ranurasUsadas--;
+        ocupadas.pop_back();
+        columnas.truncar(ranurasUsadas);
+    } else {
+        alumnos[ranura] = Alumno();
+        ocupadas[ranura] = 0;
+        ranurasLibres.push_back(ranura);
+    }
+}
+
+
+string_view SistemaAdministrativo::reemplazarCadena(string_view anterior, string_view nueva) {
+    if (anterior == nueva) return anterior;
+    cadenas.liberar(anterior);
+    return cadenas.guardar(nueva);
+}
+
+
+void SistemaAdministrativo::revisarCadenas() {
+    if (cadenas.bytesLibres() >= BYTES_MINIMOS_COMPACTACION_CADENAS &&
+        cadenas.bytesLibres() > cadenas.bytesVivos()) {
+        compactarCadenas();
+    }
+}
+
+
+void SistemaAdministrativo::registrarCambio(CambioBitacora& cambio) {
+    cambio.secuencia = ++secuencia;
+    if (bitacora && !bitacora->registrar(cambio)) {
+        cerr << "Error: No se pudo registrar el cambio en la bitácora." << endl;
+    }
+}
+
+
+bool SistemaAdministrativo::insertarAlumno(const Alumno& alumno) {
+    if (!asegurarRanura()) {
+        return false;
+    }
+    
+    anexarAlumno(alumno);
+    
+    CambioBitacora cambio;
+    cambio.tipo = TipoCambio::ALTA;
+    cambio.matricula = alumno.matricula;
+    cambio.nombre = alumno.nombre;
+    cambio.nuevaMatricula = alumno.matricula;
+    cambio.calificacion1 = alumno.calificacion1;
+    cambio.calificacion2 = alumno.calificacion2;
+    cambio.calificacion3 = alumno.calificacion3;
+    registrarCambio(cambio);
+    return true;
+}
+
+
+void SistemaAdministrativo::actualizarAlumno(int posicion, const Alumno& alumno) {
+    CambioBitacora cambio;
+    cambio.tipo = TipoCambio::MODIFICACION;
+    cambio.matricula = alumnos[posicion].matricula;
+    
+    if (alumnos[posicion].matricula != alumno.matricula) {
+        indiceMatriculas.eliminar(alumnos[posicion].matricula, posicion);
+        indiceMatriculas.insertar(alumno.matricula, posicion);
+    }
+    estadisticas.quitar(aCentesimas(alumnos[posicion].calificacionFinal));
+    ranking.eliminar(aCentesimas(alumnos[posicion].calificacionFinal), posicion);
+    desindexarCalificaciones(posicion);
+    Alumno anterior = alumnos[posicion];
+    alumnos[posicion] = alumno;
+    alumnos[posicion].nombre = reemplazarCadena(anterior.nombre, alumno.nombre);
+    alumnos[posicion].matricula = reemplazarCadena(anterior.matricula, alumno.matricula);
+    alumnos[posicion].calcularCalificacionFinal();
+    columnas.asignar(posicion, alumno.calificacion1, alumno.calificacion2, alumno.calificacion3,
+                     alumnos[posicion].calificacionFinal);
+    estadisticas.agregar(aCentesimas(alumnos[posicion].calificacionFinal));
+    ranking.insertar(aCentesimas(alumnos[posicion].calificacionFinal), posicion);
+    indexarCalificaciones(posicion);
+    if (anterior.nombre != alumno.nombre) {
+        indiceNombres.eliminar(posicion);
+        indiceNombres.insertar(alumnos[posicion].nombre, posicion);
+    }
+    
+    cambio.nombre = alumno.nombre;
+    cambio.nuevaMatricula = alumno.matricula;
+    cambio.calificacion1 = alumno.calificacion1;
+    cambio.calificacion2 = alumno.calificacion2;
+    cambio.calificacion3 = alumno.calificacion3;
+    registrarCambio(cambio);
+    revisarCadenas();
+}
+
+
+void SistemaAdministrativo::quitarAlumno(int posicion) {
+    CambioBitacora cambio;
+    cambio.tipo = TipoCambio::BAJA;
+    cambio.matricula = alumnos[posicion].matricula;
+    
+    indiceMatriculas.eliminar(alumnos[posicion].matricula, posicion);
+    estadisticas.quitar(aCentesimas(alumnos[posicion].calificacionFinal));
+    ranking.eliminar(aCentesimas(alumnos[posicion].calificacionFinal), posicion);
+    desindexarCalificaciones(posicion);
+    indiceNombres.eliminar(posicion);
+    cadenas.liberar(alumnos[posicion].nombre);
+    cadenas.liberar(alumnos[posicion].matricula);
+    cantidadAlumnos--;
+    
+    int ultima = ranurasUsadas - 1;
+    if (modoBaja == ModoBaja::INTERCAMBIO && posicion != ultima && ocupadas[ultima]) {
+        int centesimas = aCentesimas(alumnos[ultima].calificacionFinal);
+        ranking.eliminar(centesimas, ultima);
+        desindexarCalificaciones(ultima);
+        indiceNombres.eliminar(ultima);
+        alumnos[posicion] = alumnos[ultima];
+        indiceMatriculas.reubicar(alumnos[posicion].matricula, ultima, posicion);
+        columnas.mover(ultima, posicion);
+        ranking.insertar(centesimas, posicion);
+        indexarCalificaciones(posicion);
+        indiceNombres.insertar(alumnos[posicion].nombre, posicion);
+        posicion = ultima;
+    }
+    liberarRanura(posicion);
+    
+    if (ranurasLibres.size() >= LAPIDAS_MINIMAS_COMPACTACION &&
+        ranurasLibres.size() * 2 > static_cast<size_t>(ranurasUsadas)) {
+        compactarRegistro();
+    }
+    registrarCambio(cambio);
+    revisarCadenas();
+}
+
+
+bool SistemaAdministrativo::incorporarLinea(const LineaAlumno& linea, int numeroLinea, int& errores) {
+    INSTRUMENTAR_CONTAR(LINEAS_ANALIZADAS, 1);
+    if (linea.estado != EstadoLinea::VALIDA) {
+        cerr << "Advertencia: Línea " << numeroLinea 
+             << " ignorada (" << motivoLinea(linea.estado) << ")." << endl;
+        errores++;
+        return false;
+    }
+    
+    
+    bool duplicada;
+    {
+        INSTRUMENTAR_TIEMPO(DUPLICADOS);
+        duplicada = buscarIndice(linea.matricula) != -1;
+    }
+    if (duplicada) {
+        cerr << "Advertencia: Línea " << numeroLinea 
+             << " ignorada (matrícula duplicada: " << linea.matricula << ")." << endl;
+        errores++;
+        return false;
+    }
+    
+    
+    if (!asegurarRanura()) {
+        return false;
+    }
+    
+    anexarAlumno(Alumno(linea.nombre, linea.matricula,
+                        linea.calificacion1, linea.calificacion2, linea.calificacion3));
+    return true;
+}
+
+
+int SistemaAdministrativo::cargarEnParalelo(const ArchivoMapeado& archivo, int hilos, int& errores) {
+    vector<string_view> bloques = dividirEnBloques(archivo.datos(), archivo.tamano(), hilos * 4);
+    vector<BloqueAnalizado> resultados(bloques.size());
+    
+    {
+        INSTRUMENTAR_TIEMPO(ANALISIS);
+        PoolHilos pool(hilos);
+        vector<future<void>> pendientes;
+        for (size_t i = 0; i < bloques.size(); i++) {
+            pendientes.push_back(pool.enviar([&bloques, &resultados, i] {
+                analizarBloque(bloques[i], CALIFICACION_MIN, CALIFICACION_MAX, resultados[i]);
+            }));
+        }
+        for (size_t i = 0; i < pendientes.size(); i++) {
+            pendientes[i].get();
+        }
+    }
+    
+    size_t totalLineas = 0;
+    for (size_t i = 0; i < resultados.size(); i++) {
+        totalLineas += resultados[i].lineas.size();
+    }
+    reservar(static_cast<int>(totalLineas));
+    
+    int alumnosCargados = 0;
+    int lineasPrevias = 0;
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const vector<BloqueAnalizado::Linea>& lineas = resultados[i].lineas;
+        for (size_t j = 0; j < lineas.size(); j++) {
+            if (incorporarLinea(lineas[j].datos, lineasPrevias + lineas[j].numero, errores)) {
+                alumnosCargados++;
+            }
+        }
+        lineasPrevias += resultados[i].totalLineas;
+    }
+    return alumnosCargados;
+}
+
+
+const char* SistemaAdministrativo::leerCalificacionLote(string_view campo, double& calificacion) {
+    EstadoLinea estado = convertirCalificacion(campo, calificacion);
+    if (estado != EstadoLinea::VALIDA) return motivoLinea(estado);
+    if (calificacion < CALIFICACION_MIN || calificacion > CALIFICACION_MAX) {
+        return motivoLinea(EstadoLinea::CALIFICACIONES_FUERA_DE_RANGO);
+    }
+    return nullptr;
+}
+
+
+const char* SistemaAdministrativo::ejecutarComando(const ComandoLote& comando, int numeroLinea, ostream& salida,
+                                                   bool& cambio) {
+    const string_view* campos = comando.campos;
+    if (comando.tipo == TipoComando::DESCONOCIDO) return "comando desconocido";
+    if (!camposCompletos(comando)) return "número de campos incorrecto";
+    
+    switch (comando.tipo) {
+        case TipoComando::ALTA: {
+            if (campos[1].empty() || campos[2].empty()) return motivoLinea(EstadoLinea::CAMPOS_VACIOS);
+            if (buscarIndice(campos[2]) != -1) return "matrícula duplicada";
+            
+            double calificaciones[3];
+            for (int i = 0; i < 3; i++) {
+                const char* motivo = leerCalificacionLote(campos[3 + i], calificaciones[i]);
+                if (motivo) return motivo;
+            }
+            if (!insertarAlumno(Alumno(campos[1], campos[2], calificaciones[0],
+                                       calificaciones[1], calificaciones[2]))) {
+                return "memoria insuficiente";
+            }
+            cambio = true;
+            salida << "ok|" << numeroLinea << "|alta|" << campos[2] << '\n';
+            return nullptr;
+        }
+        case TipoComando::MODIFICAR: {
+            int posicion = buscarIndice(campos[1]);
+            if (posicion == -1) return "alumno no encontrado";
+            
+            Alumno modificado = alumnos[posicion];
+            if (!campos[2].empty()) modificado.nombre = campos[2];
+            if (!campos[3].empty() && campos[3] != modificado.matricula) {
+                if (buscarIndice(campos[3]) != -1) return "matrícula duplicada";
+                modificado.matricula = campos[3];
+            }
+            double* calificaciones[3] = {&modificado.calificacion1, &modificado.calificacion2,
+                                         &modificado.calificacion3};
+            for (int i = 0; i < 3; i++) {
+                if (campos[4 + i].empty()) continue;
+                const char* motivo = leerCalificacionLote(campos[4 + i], *calificaciones[i]);
+                if (motivo) return motivo;
+            }
+            actualizarAlumno(posicion, modificado);
+            cambio = true;
+            salida << "ok|" << numeroLinea << "|modificar|" << alumnos[posicion].matricula << '\n';
+            return nullptr;
+        }
+        case TipoComando::BAJA:
+            if (!eliminarPorMatricula(campos[1])) return "alumno no encontrado";
+            cambio = true;
+            salida << "ok|" << numeroLinea << "|baja|" << campos[1] << '\n';
+            return nullptr;
+        case TipoComando::CONSULTA: {
+            int posicion = buscarIndice(campos[1]);
+            if (posicion == -1) return "alumno no encontrado";
+            
+            const Alumno& alumno = alumnos[posicion];
+            salida << "ok|" << numeroLinea << "|consulta|" << alumno.nombre << '|' << alumno.matricula
+                   << '|' << alumno.calificacion1 << '|' << alumno.calificacion2 << '|'
+                   << alumno.calificacion3 << '|' << alumno.calificacionFinal << '|'
+                   << (alumno.estaAprobado() ? "APROBADO" : "REPROBADO") << '\n';
+            return nullptr;
+        }
+        case TipoComando::REPORTE: {
+            if (cantidadAlumnos == 0) return "no hay alumnos registrados";
+            FormatoReporte formato = FormatoReporte::TEXTO;
+            if (!campos[2].empty() && !formatoDesdeNombre(campos[2], formato)) return "formato desconocido";
+            string nombreArchivo = campos[1].empty() ? string(archivoReportePorOmision(formato)) 
+                                                     : string(campos[1]);
+            if (!escribirReporte(nombreArchivo, formato)) return "no se pudo escribir el reporte";
+            
+            ResumenCalificaciones resumen = resumirFinales();
+            salida << "ok|" << numeroLinea << "|reporte|" << nombreArchivo << '|' << cantidadAlumnos
+                   << '|' << promedioDe(resumen) << '|' << desviacionDe(resumen) << '|'
+                   << resumen.aprobados << '|' << cantidadAlumnos - static_cast<int>(resumen.aprobados)
+                   << '|' << resumen.maximo << '|' << resumen.minimo << '\n';
+            return nullptr;
+        }
+        case TipoComando::MEJORES:
+        case TipoComando::PEORES: {
+            long k = 0;
+            from_chars_result leido = from_chars(campos[1].data(), campos[1].data() + campos[1].size(), k);
+            if (leido.ec != errc() || leido.ptr != campos[1].data() + campos[1].size() || k < 1) {
+                return "k inválido";
+            }
+            
+            bool mejores = comando.tipo == TipoComando::MEJORES;
+            vector<int> posiciones = extremosCalificacion(static_cast<size_t>(k), mejores);
+            salida << "ok|" << numeroLinea << '|' << campos[0] << '|' << posiciones.size() << '\n';
+            for (size_t i = 0; i < posiciones.size(); i++) {
+                const Alumno& alumno = alumnos[posiciones[i]];
+                salida << "alumno|" << numeroLinea << '|' << (i + 1) << '|' << alumno.matricula << '|'
+                       << alumno.nombre << '|' << alumno.calificacionFinal << '\n';
+            }
+            return nullptr;
+        }
+        case TipoComando::BUSCAR: {
+            bool prefijo = false;
+            if (campos[2] == "prefijo") prefijo = true;
+            else if (!campos[2].empty() && campos[2] != "contiene") return "modo de búsqueda desconocido";
+            if (campos[1].empty()) return "nombre vacío";
+            
+            vector<int> posiciones = buscarPorNombre(campos[1], prefijo);
+            salida << "ok|" << numeroLinea << "|buscar|" << posiciones.size() << '\n';
+            for (size_t i = 0; i < posiciones.size(); i++) {
+                const Alumno& alumno = alumnos[posiciones[i]];
+                salida << "alumno|" << numeroLinea << '|' << (i + 1) << '|' << alumno.matricula << '|'
+                       << alumno.nombre << '|' << alumno.calificacionFinal << '\n';
+            }
+            return nullptr;
+        }
+        case TipoComando::PERCENTIL: {
+            int columna = columnaDeComando(campos[1]);
+            if (columna < 0) return "columna desconocida";
+            double p = 0;
+            from_chars_result leido = from_chars(campos[2].data(), campos[2].data() + campos[2].size(), p);
+            if (leido.ec != errc() || leido.ptr != campos[2].data() + campos[2].size() || p < 0 || p > 100) {
+                return "percentil inválido";
+            }
+            if (cantidadAlumnos == 0) return "no hay alumnos registrados";
+            
+            salida << "ok|" << numeroLinea << "|percentil|" << campos[1] << '|' << campos[2] << '|'
+                   << distribucion(columna).percentil(p) << '\n';
+            return nullptr;
+        }
+        case TipoComando::DISTRIBUCION: {
+            int columna = columnaDeComando(campos[1]);
+            if (columna < 0) return "columna desconocida";
+            long intervalos = 10;
+            if (!campos[2].empty()) {
+                from_chars_result leido = from_chars(campos[2].data(), campos[2].data() + campos[2].size(), 
+                                                     intervalos);
+                if (leido.ec != errc() || leido.ptr != campos[2].data() + campos[2].size() || 
+                    intervalos < 1 || intervalos > INTERVALOS_MAXIMOS_HISTOGRAMA) {
+                    return "número de intervalos inválido";
+                }
+            }
+            if (cantidadAlumnos == 0) return "no hay alumnos registrados";
+            
+            const DistribucionCalificaciones& datos = distribucion(columna);
+            int total = static_cast<int>(intervalos);
+            salida << "ok|" << numeroLinea << "|distribucion|" << campos[1] << '|' << datos.tamano() << '|'
+                   << datos.kEsimo(1) / 100.0 << '|' << datos.percentil(25) << '|' << datos.percentil(50) 
+                   << '|' << datos.percentil(75) << '|' << datos.kEsimo(datos.tamano()) / 100.0 << '\n';
+            vector<size_t> histograma = datos.histograma(total);
+            for (int i = 0; i < total; i++) {
+                double desde = DistribucionCalificaciones::limiteIntervalo(i, total) / 100.0;
+                double hasta = i + 1 == total ? CALIFICACION_MAX
+                             : (DistribucionCalificaciones::limiteIntervalo(i + 1, total) - 1) / 100.0;
+                salida << "intervalo|" << numeroLinea << '|' << desde << '|' << hasta << '|' 
+                       << histograma[i] << '\n';
+            }
+            return nullptr;
+        }
+        case TipoComando::RANGO: {
+            int columna = columnaDeComando(campos[1]);
+            if (columna < 0) return "columna desconocida";
+            double minimo, maximo;
+            const char* motivo = leerCalificacionLote(campos[2], minimo);
+            if (!motivo) motivo = leerCalificacionLote(campos[3], maximo);
+            if (motivo) return motivo;
+            if (minimo > maximo) return "rango inválido";
+            
+            vector<int> posiciones = alumnosEnRango(columna, minimo, maximo);
+            const double* valores = columnaRango(columna);
+            salida << "ok|" << numeroLinea << "|rango|" << campos[1] << '|' << posiciones.size() << '\n';
+            for (size_t i = 0; i < posiciones.size(); i++) {
+                const Alumno& alumno = alumnos[posiciones[i]];
+                salida << "alumno|" << numeroLinea << '|' << (i + 1) << '|' << alumno.matricula << '|'
+                       << alumno.nombre << '|' << valores[posiciones[i]] << '\n';
+            }
+            return nullptr;
+        }
+        case TipoComando::FUSIONAR: {
+            ResultadoFusion fusion = fusionarCalificaciones(string(campos[1]));
+            if (!fusion.leido) return "no se pudo abrir el archivo";
+            cambio = fusion.insertados + fusion.actualizados > 0;
+            salida << "ok|" << numeroLinea << "|fusionar|" << campos[1] << '|' << fusion.insertados << '|'
+                   << fusion.actualizados << '|' << fusion.sinCambios << '|' << fusion.rechazados << '\n';
+            return nullptr;
+        }
+        default:
+            return "comando desconocido";
+    }
+}
+
+
+SistemaAdministrativo::SistemaAdministrativo()
+    : alumnos(nullptr), cantidadAlumnos(0), ranurasUsadas(0), capacidad(CAPACIDAD_INICIAL),
+      modoBaja(ModoBaja::LAPIDA), estadisticas(CALIFICACION_APROBATORIA), bitacora(nullptr), secuencia(0) {
+    alumnos = reservarRanuras(capacidad);
+    if (!alumnos) {
+        cerr << "Error crítico: No se pudo inicializar el sistema." << endl;
+        capacidad = 0;
+    }
+}
+
+
+SistemaAdministrativo::SistemaAdministrativo(const SistemaAdministrativo& otro)
+    : cantidadAlumnos(otro.cantidadAlumnos), ranurasUsadas(otro.ranurasUsadas), capacidad(otro.capacidad),
+      ocupadas(otro.ocupadas), ranurasLibres(otro.ranurasLibres), modoBaja(otro.modoBaja),
+      indiceMatriculas(otro.indiceMatriculas), columnas(otro.columnas),
+      estadisticas(otro.estadisticas), ranking(otro.ranking), bitacora(nullptr), secuencia(otro.secuencia) {
+    copiarAlumnosDe(otro);
+}
+
+
+SistemaAdministrativo::SistemaAdministrativo(SistemaAdministrativo&& otro) noexcept
+    : alumnos(otro.alumnos), cantidadAlumnos(otro.cantidadAlumnos), ranurasUsadas(otro.ranurasUsadas),
+      capacidad(otro.capacidad), ocupadas(std::move(otro.ocupadas)),
+      ranurasLibres(std::move(otro.ranurasLibres)), modoBaja(otro.modoBaja),
+      indiceMatriculas(std::move(otro.indiceMatriculas)), columnas(std::move(otro.columnas)),
+      estadisticas(std::move(otro.estadisticas)), ranking(std::move(otro.ranking)),
+      cadenas(std::move(otro.cadenas)), bitacora(otro.bitacora), secuencia(otro.secuencia) {
+    otro.alumnos = nullptr;
+    otro.capacidad = 0;
+    otro.bitacora = nullptr;
+    otro.vaciarRegistro();
+}
+
+
+SistemaAdministrativo& SistemaAdministrativo::operator=(const SistemaAdministrativo& otro) {
+    if (this != &otro) {
+        liberarAlmacenamiento();
+        cantidadAlumnos = otro.cantidadAlumnos;
+        ranurasUsadas = otro.ranurasUsadas;
+        capacidad = otro.capacidad;
+        ocupadas = otro.ocupadas;
+        ranurasLibres = otro.ranurasLibres;
+        modoBaja = otro.modoBaja;
+        indiceMatriculas = otro.indiceMatriculas;
+        columnas = otro.columnas;
+        estadisticas = otro.estadisticas;
+        ranking = otro.ranking;
+        limpiarRangos();
+        limpiarDistribuciones();
+        indiceNombres.limpiar();
+        cadenas.limpiar();
+        secuencia = otro.secuencia;
+        copiarAlumnosDe(otro);
+    }
+    return *this;
+}
+
+
+SistemaAdministrativo& SistemaAdministrativo::operator=(SistemaAdministrativo&& otro) noexcept {
+    if (this != &otro) {
+        liberarAlmacenamiento();
+        alumnos = otro.alumnos;
+        cantidadAlumnos = otro.cantidadAlumnos;
+        ranurasUsadas = otro.ranurasUsadas;
+        capacidad = otro.capacidad;
+        ocupadas = std::move(otro.ocupadas);
+        ranurasLibres = std::move(otro.ranurasLibres);
+        modoBaja = otro.modoBaja;
+        indiceMatriculas = std::move(otro.indiceMatriculas);
+        columnas = std::move(otro.columnas);
+        estadisticas = std::move(otro.estadisticas);
+        ranking = std::move(otro.ranking);
+        limpiarRangos();
+        limpiarDistribuciones();
+        indiceNombres.limpiar();
+        cadenas = std::move(otro.cadenas);
+        bitacora = otro.bitacora;
+        secuencia = otro.secuencia;
+        
+        otro.alumnos = nullptr;
+        otro.capacidad = 0;
+        otro.bitacora = nullptr;
+        otro.vaciarRegistro();
+    }
+    return *this;
+}
+
+
+bool SistemaAdministrativo::cargarDesdeArchivo(const string& nombreArchivo, int hilos) {
+    INSTRUMENTAR_TIEMPO(CARGA);
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(nombreArchivo)) {
+        return false;
+    }
+    INSTRUMENTAR_CONTAR(BYTES_LEIDOS, archivo.tamano());
+    
+    vaciarRegistro();
+    secuencia = 0;
+    int numeroLinea = 0;
+    int alumnosCargados = 0;
+    int errores = 0;
+    
+    if (hilos > 1) {
+        alumnosCargados = cargarEnParalelo(archivo, hilos, errores);
+    } else {
+        const char* cursor = archivo.datos();
+        const char* fin = cursor + archivo.tamano();
+        reservar(static_cast<int>(count(cursor, fin, '\n')) + 1);
+        
+        while (cursor < fin) {
+            const char* salto = static_cast<const char*>(memchr(cursor, '\n', fin - cursor));
+            const char* finLinea = salto ? salto : fin;
+            numeroLinea++;
+            
+            LineaAlumno linea;
+            {
+                INSTRUMENTAR_TIEMPO(ANALISIS);
+                linea = analizarLinea(string_view(cursor, finLinea - cursor), CALIFICACION_MIN, CALIFICACION_MAX);
+            }
+            cursor = salto ? salto + 1 : fin;
+            
+            if (linea.estado == EstadoLinea::VACIA) continue;
+            
+            if (incorporarLinea(linea, numeroLinea, errores)) {
+                alumnosCargados++;
+            }
+        }
+    }
+    
+    INSTRUMENTAR_CONTAR(LINEAS_RECHAZADAS, errores);
+    if (errores > 0) {
+        cerr << "Se encontraron " << errores << " error(es) al cargar el archivo." << endl;
+    }
+    
+    return alumnosCargados > 0 || cantidadAlumnos > 0;
+}
+
+
+ResultadoFusion SistemaAdministrativo::fusionarCalificaciones(const string& nombreArchivo) {
+    INSTRUMENTAR_TIEMPO(CARGA);
+    ResultadoFusion resultado = {0, 0, 0, 0, false};
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(nombreArchivo)) {
+        return resultado;
+    }
+    resultado.leido = true;
+    INSTRUMENTAR_CONTAR(BYTES_LEIDOS, archivo.tamano());
+    
+    const char* cursor = archivo.datos();
+    const char* fin = cursor + archivo.tamano();
+    int numeroLinea = 0;
+    while (cursor < fin) {
+        const char* salto = static_cast<const char*>(memchr(cursor, '\n', fin - cursor));
+        const char* finLinea = salto ? salto : fin;
+        numeroLinea++;
+        
+        LineaAlumno linea;
+        {
+            INSTRUMENTAR_TIEMPO(ANALISIS);
+            linea = analizarActualizacion(string_view(cursor, finLinea - cursor), CALIFICACION_MIN, CALIFICACION_MAX);
+        }
+        cursor = salto ? salto + 1 : fin;
+        if (linea.estado == EstadoLinea::VACIA) continue;
+        INSTRUMENTAR_CONTAR(LINEAS_ANALIZADAS, 1);
+        
+        if (linea.estado != EstadoLinea::VALIDA) {
+            cerr << "Advertencia: Línea " << numeroLinea 
+                 << " rechazada (" << motivoLinea(linea.estado) << ")." << endl;
+            resultado.rechazados++;
+            continue;
+        }
+        
+        int posicion = buscarIndice(linea.matricula);
+        if (posicion == -1) {
+            if (linea.nombre.empty()) {
+                cerr << "Advertencia: Línea " << numeroLinea 
+                     << " rechazada (matrícula no registrada: " << linea.matricula << ")." << endl;
+                resultado.rechazados++;
+            } else if (insertarAlumno(Alumno(linea.nombre, linea.matricula, linea.calificacion1,
+                                             linea.calificacion2, linea.calificacion3))) {
+                resultado.insertados++;
+            } else {
+                resultado.rechazados++;
+            }
+            continue;
+        }
+        
+        const Alumno& actual = alumnos[posicion];
+        if (actual.calificacion1 == linea.calificacion1 && actual.calificacion2 == linea.calificacion2 &&
+            actual.calificacion3 == linea.calificacion3 &&
+            (linea.nombre.empty() || actual.nombre == linea.nombre)) {
+            resultado.sinCambios++;
+            continue;
+        }
+        
+        Alumno modificado = actual;
+        if (!linea.nombre.empty()) modificado.nombre = linea.nombre;
+        modificado.calificacion1 = linea.calificacion1;
+        modificado.calificacion2 = linea.calificacion2;
+        modificado.calificacion3 = linea.calificacion3;
+        actualizarAlumno(posicion, modificado);
+        resultado.actualizados++;
+    }
+    INSTRUMENTAR_CONTAR(LINEAS_RECHAZADAS, resultado.rechazados);
+    return resultado;
+}
+
+
+bool SistemaAdministrativo::guardarEnArchivo(const string& nombreArchivo) {
+    INSTRUMENTAR_TIEMPO(GUARDADO);
+    EscritorBuffer archivo;
+    if (!archivo.abrirReemplazo(nombreArchivo)) {
+        cerr << "Error: No se pudo abrir el archivo para escritura." << endl;
+        return false;
+    }
+    
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (ocupadas[i] && alumnos[i].validarDatos()) {
+            archivo << alumnos[i].nombre << '|'
+                    << alumnos[i].matricula << '|'
+                    << Fijo(alumnos[i].calificacion1, 2) << '|'
+                    << Fijo(alumnos[i].calificacion2, 2) << '|'
+                    << Fijo(alumnos[i].calificacion3, 2) << '\n';
+        }
+    }
+    
+    return archivo.cerrar();
+}
+
+
+bool SistemaAdministrativo::cargarBinario(const string& nombreArchivo) {
+    INSTRUMENTAR_TIEMPO(CARGA);
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(nombreArchivo)) {
+        return false;
+    }
+    INSTRUMENTAR_CONTAR(BYTES_LEIDOS, archivo.tamano());
+    
+    CabeceraBinaria cabecera;
+    if (!leerCabeceraBinaria(archivo.datos(), archivo.tamano(), cabecera) ||
+        cabecera.cantidad > static_cast<uint64_t>(numeric_limits<int>::max())) {
+        cerr << "Advertencia: " << nombreArchivo << " no es una instantánea válida." << endl;
+        return false;
+    }
+    
+    size_t cantidad = cabecera.cantidad;
+    const char* longitudes = archivo.datos() + tamanoCabecera(cabecera.version);
+    const char* cadenas = longitudes + 2 * cantidad * sizeof(uint32_t);
+    const char* calificaciones = cadenas + cabecera.bytesCadenas;
+    
+    vaciarRegistro();
+    secuencia = cabecera.secuencia;
+    reservar(static_cast<int>(cantidad));
+    
+    int errores = 0;
+    size_t desplazamiento = 0;
+    for (size_t i = 0; i < cantidad; i++) {
+        uint32_t longitudNombre, longitudMatricula;
+        memcpy(&longitudNombre, longitudes + 2 * i * sizeof(uint32_t), sizeof(uint32_t));
+        memcpy(&longitudMatricula, longitudes + (2 * i + 1) * sizeof(uint32_t), sizeof(uint32_t));
+        if (desplazamiento + longitudNombre + longitudMatricula > cabecera.bytesCadenas) {
+            cerr << "Advertencia: " << nombreArchivo << " está truncado en el registro " 
+                 << (i + 1) << "." << endl;
+            errores++;
+            break;
+        }
+        
+        string_view nombre(cadenas + desplazamiento, longitudNombre);
+        string_view matricula(cadenas + desplazamiento + longitudNombre, longitudMatricula);
+        desplazamiento += longitudNombre + longitudMatricula;
+        
+        uint16_t cal1, cal2, cal3;
+        memcpy(&cal1, calificaciones + i * sizeof(uint16_t), sizeof(uint16_t));
+        memcpy(&cal2, calificaciones + (cantidad + i) * sizeof(uint16_t), sizeof(uint16_t));
+        memcpy(&cal3, calificaciones + (2 * cantidad + i) * sizeof(uint16_t), sizeof(uint16_t));
+        
+        Alumno alumno(nombre, matricula, cal1 / 100.0, cal2 / 100.0, cal3 / 100.0);
+        if (!alumno.validarDatos() || buscarIndice(matricula) != -1) {
+            cerr << "Advertencia: Registro " << (i + 1) << " ignorado (datos inválidos o duplicados)." << endl;
+            errores++;
+            continue;
+        }
+        
+        anexarAlumno(alumno);
+    }
+    
+    if (errores > 0) {
+        cerr << "Se encontraron " << errores << " error(es) al cargar el archivo." << endl;
+    }
+    
+    return true;
+}
+
+
+vector<char> SistemaAdministrativo::instantaneaBinaria() const {
+    uint64_t cantidad = 0, bytesCadenas = 0;
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (ocupadas[i] && alumnos[i].validarDatos()) {
+            cantidad++;
+            bytesCadenas += alumnos[i].nombre.size() + alumnos[i].matricula.size();
+        }
+    }
+    
+    vector<char> bufer(tamanoBinario(cantidad, bytesCadenas));
+    CabeceraBinaria cabecera;
+    memcpy(cabecera.magia, MAGIA_BINARIA, sizeof(MAGIA_BINARIA));
+    cabecera.version = VERSION_BINARIA;
+    cabecera.marcaOrden = MARCA_ORDEN;
+    cabecera.reservado = 0;
+    cabecera.cantidad = cantidad;
+    cabecera.bytesCadenas = bytesCadenas;
+    cabecera.secuencia = secuencia;
+    memcpy(bufer.data(), &cabecera, sizeof(cabecera));
+    
+    char* longitudes = bufer.data() + sizeof(cabecera);
+    char* cadenas = longitudes + 2 * cantidad * sizeof(uint32_t);
+    char* calificaciones = cadenas + bytesCadenas;
+    
+    size_t j = 0;
+    for (int i = 0; i < ranurasUsadas; i++) {
+        const Alumno& alumno = alumnos[i];
+        if (!ocupadas[i] || !alumno.validarDatos()) continue;
+        
+        uint32_t longitudNombre = static_cast<uint32_t>(alumno.nombre.size());
+        uint32_t longitudMatricula = static_cast<uint32_t>(alumno.matricula.size());
+        memcpy(longitudes + 2 * j * sizeof(uint32_t), &longitudNombre, sizeof(uint32_t));
+        memcpy(longitudes + (2 * j + 1) * sizeof(uint32_t), &longitudMatricula, sizeof(uint32_t));
+        memcpy(cadenas, alumno.nombre.data(), longitudNombre);
+        memcpy(cadenas + longitudNombre, alumno.matricula.data(), longitudMatricula);
+        cadenas += longitudNombre + longitudMatricula;
+        
+        uint16_t cal1 = aCentesimas(alumno.calificacion1);
+        uint16_t cal2 = aCentesimas(alumno.calificacion2);
+        uint16_t cal3 = aCentesimas(alumno.calificacion3);
+        memcpy(calificaciones + j * sizeof(uint16_t), &cal1, sizeof(uint16_t));
+        memcpy(calificaciones + (cantidad + j) * sizeof(uint16_t), &cal2, sizeof(uint16_t));
+        memcpy(calificaciones + (2 * cantidad + j) * sizeof(uint16_t), &cal3, sizeof(uint16_t));
+        j++;
+    }
+    return bufer;
+}
+
+
+bool SistemaAdministrativo::guardarBinario(const string& nombreArchivo) const {
+    INSTRUMENTAR_TIEMPO(GUARDADO);
+    vector<char> bufer = instantaneaBinaria();
+    
+    EscritorBuffer archivo;
+    if (!archivo.abrirReemplazo(nombreArchivo)) {
+        cerr << "Error: No se pudo abrir el archivo para escritura." << endl;
+        return false;
+    }
+    archivo.escribirBytes(bufer.data(), bufer.size());
+    return archivo.cerrar();
+}
+
+
+vector<int> SistemaAdministrativo::buscarPorNombre(string_view texto, bool prefijo) {
+    if (!indiceNombres.estaActivo()) {
+        indiceNombres.reiniciar(static_cast<size_t>(ranurasUsadas));
+        for (int i = 0; i < ranurasUsadas; i++) {
+            if (ocupadas[i]) indiceNombres.insertar(alumnos[i].nombre, i);
+        }
+    }
+    return indiceNombres.buscar(texto, prefijo);
+}
+
+
+double SistemaAdministrativo::promedioDe(const ResumenCalificaciones& resumen) {
+    if (resumen.cantidad == 0) return 0.0;
+    return round((resumen.suma / resumen.cantidad) * 100.0) / 100.0;
+}
+
+
+double SistemaAdministrativo::desviacionDe(const ResumenCalificaciones& resumen) {
+    if (resumen.cantidad == 0) return 0.0;
+    
+    double promedio = promedioDe(resumen);
+    double sumaCuadrados = resumen.sumaCuadrados - 2.0 * promedio * resumen.suma 
+                         + resumen.cantidad * promedio * promedio;
+    double varianza = max(0.0, sumaCuadrados / resumen.cantidad);
+    return round(sqrt(varianza) * 100.0) / 100.0;
+}
+
+
+vector<int> SistemaAdministrativo::alumnosEnRango(int columna, double minimo, double maximo) {
+    IndiceRangos& indice = rangos[columna];
+    const double* valores = columnaRango(columna);
+    if (!indice.estaActivo()) {
+        indice.reconstruir(valores, columnas.tamano(), ocupadas.data());
+    }
+    
+    // El índice guarda centésimas redondeadas: se consulta el rango de
+    // centésimas que lo cubre y se descartan los valores de los bordes.
+    vector<int> posiciones = indice.rango(static_cast<int>(floor(minimo * 100.0)), 
+                                          static_cast<int>(ceil(maximo * 100.0)));
+    posiciones.erase(remove_if(posiciones.begin(), posiciones.end(), [&](int posicion) {
+        return valores[posicion] < minimo || valores[posicion] > maximo;
+    }), posiciones.end());
+    return posiciones;
+}
+
+
+vector<int> SistemaAdministrativo::alumnosAprobados() {
+    vector<int> posiciones = alumnosEnRango(0, CALIFICACION_APROBATORIA, CALIFICACION_MAX);
+    sort(posiciones.begin(), posiciones.end());
+    return posiciones;
+}
+
+
+vector<int> SistemaAdministrativo::alumnosReprobados() {
+    vector<int> posiciones = alumnosEnRango(0, CALIFICACION_MIN, CALIFICACION_APROBATORIA);
+    posiciones.erase(remove_if(posiciones.begin(), posiciones.end(), [this](int posicion) {
+        return alumnos[posicion].estaAprobado();
+    }), posiciones.end());
+    sort(posiciones.begin(), posiciones.end());
+    return posiciones;
+}
+
+
+const DistribucionCalificaciones& SistemaAdministrativo::distribucion(int columna) {
+    if (!distribuciones[columna].estaActivo()) {
+        distribuciones[columna].reconstruir(columnaRango(columna), columnas.tamano(), ocupadas.data());
+    }
+    return distribuciones[columna];
+}
+
+
+void SistemaAdministrativo::escribirAlumnosTexto(EscritorBuffer& archivo, int desde, int hasta, int numero) const {
+    for (int i = desde; i < hasta; i++) {
+        if (!ocupadas[i]) continue;
+        const Alumno& alumno = alumnos[i];
+        archivo << "\nAlumno " << numero++ << ":\n";
+        archivo << "  Nombre: " << alumno.nombre << '\n';
+        archivo << "  Matrícula: " << alumno.matricula << '\n';
+        archivo << "  Calificación Parcial 1: " << Fijo(alumno.calificacion1, 2) << '\n';
+        archivo << "  Calificación Parcial 2: " << Fijo(alumno.calificacion2, 2) << '\n';
+        archivo << "  Calificación Parcial 3: " << Fijo(alumno.calificacion3, 2) << '\n';
+        archivo << "  Calificación Final: " << Fijo(alumno.calificacionFinal, 2) << '\n';
+        archivo << "  Estado: " << (alumno.estaAprobado() ? "APROBADO" : "REPROBADO") << '\n';
+    }
+}
+
+
+void SistemaAdministrativo::escribirReporteTexto(EscritorBuffer& archivo, int hilos) const {
+    const string separador(50, '=');
+    const string linea(50, '-');
+    
+    archivo << separador << '\n';
+    archivo << "     REPORTE GENERAL DE ALUMNOS\n";
+    archivo << separador << "\n\n";
+    
+    archivo << "Fecha de generación: " << __DATE__ << " " << __TIME__ << '\n';
+    archivo << "Total de Alumnos: " << cantidadAlumnos << "\n\n";
+    
+    archivo << linea << '\n';
+    archivo << "INFORMACIÓN DE ALUMNOS\n";
+    archivo << linea << '\n';
+    
+    // Se cuenta aparte en vez de usar la distribución mantenida, cuyos
+    // acumulados se recalculan al consultarla: así el reporte no
+    // modifica nada y puede escribirse desde varios lectores a la vez.
+    DistribucionCalificaciones calculada;
+    
+    // Cortes entre partes con el mismo número de alumnos, y el número del
+    // primer alumno de cada una.
+    vector<int> cortes(1, 0);
+    vector<int> numeros(1, 1);
+    if (hilos > 1) {
+        int contados = 0;
+        for (int i = 0; i < ranurasUsadas; i++) {
+            if (ocupadas[i] && ++contados % ALUMNOS_POR_PARTE_REPORTE == 0 && i + 1 < ranurasUsadas) {
+                cortes.push_back(i + 1);
+                numeros.push_back(contados + 1);
+            }
+        }
+    }
+    cortes.push_back(ranurasUsadas);
+    size_t partes = cortes.size() - 1;
+    
+    if (partes == 1) {
+        escribirAlumnosTexto(archivo, 0, ranurasUsadas, 1);
+        calculada.reconstruir(columnas.finales(), columnas.tamano(), ocupadas.data());
+    } else {
+        // Hay a lo más `ventana` partes en curso, cada una en su ranura: la
+        // parte p reutiliza la ranura de p - ventana, que ya se escribió.
+        // Así la memoria no depende del tamaño del reporte.
+        size_t ventana = min(partes, static_cast<size_t>(hilos) * 2);
+        vector<EscritorBuffer> textos(ventana);
+        vector<DistribucionCalificaciones> distribuciones(ventana);
+        vector<future<void>> pendientes(ventana);
+        PoolHilos pool(hilos);
+        
+        auto enviar = [&](size_t parte) {
+            size_t ranura = parte % ventana;
+            pendientes[ranura] = pool.enviar([this, &textos, &distribuciones, &cortes, &numeros, parte, ranura] {
+                int desde = cortes[parte], hasta = cortes[parte + 1];
+                textos[ranura].abrirEnMemoria();
+                escribirAlumnosTexto(textos[ranura], desde, hasta, numeros[parte]);
+                distribuciones[ranura].contar(columnas.finales() + desde, hasta - desde, ocupadas.data() + desde);
+            });
+        };
+        for (size_t parte = 0; parte < ventana; parte++) {
+            enviar(parte);
+        }
+        for (size_t parte = 0; parte < partes; parte++) {
+            size_t ranura = parte % ventana;
+            pendientes[ranura].get();
+            string_view texto = textos[ranura].contenido();
+            archivo.escribirBytes(texto.data(), texto.size());
+            if (parte + ventana < partes) enviar(parte + ventana);
+        }
+        for (size_t ranura = 0; ranura < ventana; ranura++) {
+            calculada.sumar(distribuciones[ranura]);
+        }
+    }
+    
+    archivo << '\n' << linea << '\n';
+    archivo << "ESTADÍSTICAS GENERALES\n";
+    archivo << linea << '\n';
+    
+    ResumenCalificaciones resumen = resumirFinales();
+    double promedio = promedioDe(resumen);
+    double desviacion = desviacionDe(resumen);
+    
+    archivo << "Promedio General: " << Fijo(promedio, 2) << '\n';
+    archivo << "Desviación Estándar: " << Fijo(desviacion, 2) << '\n';
+    
+    
+    int aprobados = static_cast<int>(resumen.aprobados);
+    int reprobados = cantidadAlumnos - aprobados;
+    double calMax = resumen.maximo, calMin = resumen.minimo;
+    
+    archivo << "Alumnos Aprobados: " << aprobados << " (" 
+            << Fijo(aprobados * 100.0 / cantidadAlumnos, 1) << "%)\n";
+    archivo << "Alumnos Reprobados: " << reprobados << " (" 
+            << Fijo(reprobados * 100.0 / cantidadAlumnos, 1) << "%)\n";
+    archivo << "Calificación Máxima: " << Fijo(calMax, 2) << '\n';
+    archivo << "Calificación Mínima: " << Fijo(calMin, 2) << '\n';
+    
+    archivo << '\n' << linea << '\n';
+    archivo << "DISTRIBUCIÓN DE CALIFICACIONES FINALES\n";
+    archivo << linea << '\n';
+    archivo << "Percentil 10: " << Fijo(calculada.percentil(10), 2) << '\n';
+    archivo << "Primer Cuartil: " << Fijo(calculada.percentil(25), 2) << '\n';
+    archivo << "Mediana: " << Fijo(calculada.percentil(50), 2) << '\n';
+    archivo << "Tercer Cuartil: " << Fijo(calculada.percentil(75), 2) << '\n';
+    archivo << "Percentil 90: " << Fijo(calculada.percentil(90), 2) << '\n';
+    
+    const int intervalos = 10;
+    vector<size_t> histograma = calculada.histograma(intervalos);
+    for (int i = 0; i < intervalos; i++) {
+        double desde = DistribucionCalificaciones::limiteIntervalo(i, intervalos) / 100.0;
+        double hasta = i + 1 == intervalos ? CALIFICACION_MAX
+                     : (DistribucionCalificaciones::limiteIntervalo(i + 1, intervalos) - 1) / 100.0;
+        archivo << "  " << Fijo(desde, 2) << " - " << Fijo(hasta, 2) << ": " 
+                << static_cast<long long>(histograma[i]) << " (" 
+                << Fijo(histograma[i] * 100.0 / cantidadAlumnos, 1) << "%)\n";
+    }
+    
+    archivo << '\n' << separador << '\n';
+}
+
+
+void SistemaAdministrativo::escribirReporteCsv(EscritorBuffer& archivo) const {
+    archivo << "nombre,matricula,calificacion1,calificacion2,calificacion3,calificacionFinal,estado\n";
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        const Alumno& alumno = alumnos[i];
+        escribirCampoCsv(archivo, alumno.nombre);
+        archivo << ',';
+        escribirCampoCsv(archivo, alumno.matricula);
+        archivo << ',' << Fijo(alumno.calificacion1, 2) << ',' << Fijo(alumno.calificacion2, 2)
+                << ',' << Fijo(alumno.calificacion3, 2) << ',' << Fijo(alumno.calificacionFinal, 2)
+                << ',' << (alumno.estaAprobado() ? "APROBADO" : "REPROBADO") << '\n';
+    }
+}
+
+
+void SistemaAdministrativo::escribirReporteJsonl(EscritorBuffer& archivo) const {
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        const Alumno& alumno = alumnos[i];
+        archivo << "{\"nombre\":";
+        escribirCadenaJson(archivo, alumno.nombre);
+        archivo << ",\"matricula\":";
+        escribirCadenaJson(archivo, alumno.matricula);
+        archivo << ",\"calificacion1\":" << Fijo(alumno.calificacion1, 2)
+                << ",\"calificacion2\":" << Fijo(alumno.calificacion2, 2)
+                << ",\"calificacion3\":" << Fijo(alumno.calificacion3, 2)
+                << ",\"calificacionFinal\":" << Fijo(alumno.calificacionFinal, 2)
+                << ",\"aprobado\":" << (alumno.estaAprobado() ? "true" : "false") << "}\n";
+    }
+}
+
+
+void SistemaAdministrativo::escribirReporteColumnar(EscritorBuffer& archivo) const {
+    CabeceraColumnar cabecera;
+    memcpy(cabecera.magia, MAGIA_COLUMNAR, sizeof(MAGIA_COLUMNAR));
+    cabecera.version = VERSION_COLUMNAR;
+    cabecera.marcaOrden = MARCA_ORDEN;
+    cabecera.reservado = 0;
+    cabecera.cantidad = static_cast<uint64_t>(cantidadAlumnos);
+    cabecera.bytesNombres = 0;
+    cabecera.bytesMatriculas = 0;
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        cabecera.bytesNombres += alumnos[i].nombre.size();
+        cabecera.bytesMatriculas += alumnos[i].matricula.size();
+    }
+    archivo.escribirBytes(&cabecera, sizeof(cabecera));
+    
+    for (int campo = 0; campo < 2; campo++) {
+        for (int i = 0; i < ranurasUsadas; i++) {
+            if (!ocupadas[i]) continue;
+            uint32_t longitud = static_cast<uint32_t>(campo == 0 ? alumnos[i].nombre.size()
+                                                                 : alumnos[i].matricula.size());
+            archivo.escribirBytes(&longitud, sizeof(longitud));
+        }
+    }
+    for (int campo = 0; campo < 2; campo++) {
+        for (int i = 0; i < ranurasUsadas; i++) {
+            if (!ocupadas[i]) continue;
+            archivo << (campo == 0 ? alumnos[i].nombre : alumnos[i].matricula);
+        }
+    }
+    
+    const double* columnasReporte[] = {columnas.parcial(1), columnas.parcial(2), columnas.parcial(3),
+                                       columnas.finales()};
+    for (const double* columna : columnasReporte) {
+        for (int i = 0; i < ranurasUsadas; i++) {
+            if (!ocupadas[i]) continue;
+            uint16_t centesimas = aCentesimas(columna[i]);
+            archivo.escribirBytes(&centesimas, sizeof(centesimas));
+        }
+    }
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        archivo << static_cast<char>(alumnos[i].estaAprobado() ? 1 : 0);
+    }
+}
+
+
+bool SistemaAdministrativo::escribirReporte(const string& nombreArchivo, FormatoReporte formato, int hilos) const {
+    INSTRUMENTAR_TIEMPO(REPORTE);
+    EscritorBuffer archivo;
+    if (!archivo.abrir(nombreArchivo)) {
+        cerr << "Error: No se pudo crear el archivo " << nombreArchivo << endl;
+        return false;
+    }
+    
+    switch (formato) {
+        case FormatoReporte::CSV:
+            escribirReporteCsv(archivo);
+            break;
+        case FormatoReporte::JSONL:
+            escribirReporteJsonl(archivo);
+            break;
+        case FormatoReporte::COLUMNAR:
+            escribirReporteColumnar(archivo);
+            break;
+        default:
+            escribirReporteTexto(archivo, hilos);
+            break;
+    }
+    return archivo.cerrar();
+}
+
+
+vector<int> SistemaAdministrativo::extremosCalificacion(size_t k, bool mejores) {
+    if (ranking.estaActivo()) {
+        if (ranking.necesitaReconstruir()) {
+            ranking.reconstruir(columnas.finales(), columnas.tamano(), ocupadas.data());
+        }
+        return ranking.extremos(k, mejores);
+    }
+    return seleccionarExtremos(columnas.finales(), columnas.tamano(), k, mejores, ocupadas.data());
+}
+
+
+bool SistemaAdministrativo::insertar(const Alumno& alumno) {
+    if (!alumno.validarDatos() || buscarIndice(alumno.matricula) != -1) return false;
+    return insertarAlumno(alumno);
+}
+
+
+bool SistemaAdministrativo::actualizar(string_view matricula, const Alumno& alumno) {
+    int posicion = buscarIndice(matricula);
+    if (posicion == -1 || !alumno.validarDatos()) return false;
+    if (alumno.matricula != matricula && buscarIndice(alumno.matricula) != -1) return false;
+    actualizarAlumno(posicion, alumno);
+    return true;
+}
+
+
+bool SistemaAdministrativo::buscar(string_view matricula, FichaAlumno& ficha) const {
+    int posicion = buscarIndice(matricula);
+    if (posicion == -1) return false;
+    ficha = fichaDe(posicion);
+    return true;
+}
+
+
+vector<FichaAlumno> SistemaAdministrativo::fichasExtremas(size_t k, bool mejores) const {
+    vector<int> posiciones = ranking.estaActivo() && !ranking.necesitaReconstruir()
+                           ? ranking.extremos(k, mejores)
+                           : seleccionarExtremos(columnas.finales(), columnas.tamano(), k, mejores, 
+                                                 ocupadas.data());
+    vector<FichaAlumno> fichas;
+    fichas.reserve(posiciones.size());
+    for (int posicion : posiciones) {
+        fichas.push_back(fichaDe(posicion));
+    }
+    return fichas;
+}
+
+
+bool SistemaAdministrativo::eliminarPorMatricula(string_view matricula) {
+    int posicion = buscarIndice(matricula);
+    if (posicion == -1) return false;
+    quitarAlumno(posicion);
+    return true;
+}
+
+
+ResultadoLote SistemaAdministrativo::ejecutarLote(istream& entrada, ostream& salida, bool estricto) {
+    ResultadoLote resultado = {0, 0, 0, false};
+    salida << fixed << setprecision(2);
+    
+    string linea;
+    int numeroLinea = 0;
+    while (getline(entrada, linea)) {
+        numeroLinea++;
+        ComandoLote comando = analizarComando(linea);
+        if (comando.tipo == TipoComando::VACIO) continue;
+        
+        resultado.comandos++;
+        bool cambio = false;
+        const char* motivo = ejecutarComando(comando, numeroLinea, salida, cambio);
+        if (motivo) {
+            resultado.errores++;
+            salida << "error|" << numeroLinea << '|' << comando.campos[0] << '|' << motivo << '\n';
+            if (estricto) {
+                resultado.interrumpido = true;
+                break;
+            }
+        } else if (cambio) {
+            resultado.cambios++;
+        }
+    }
+    return resultado;
+}
+
+
+void SistemaAdministrativo::compactarRegistro() {
+    if (ranurasUsadas == cantidadAlumnos) return;
+    
+    int destino = 0;
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        if (i != destino) {
+            alumnos[destino] = std::move(alumnos[i]);
+            indiceMatriculas.reubicar(alumnos[destino].matricula, i, destino);
+            columnas.mover(i, destino);
+        }
+        destino++;
+    }
+    
+    for (int i = destino; i < ranurasUsadas; i++) {
+        alumnos[i].~Alumno();
+    }
+    ranurasUsadas = destino;
+    ocupadas.assign(destino, 1);
+    ranurasLibres.clear();
+    columnas.truncar(destino);
+    ranking.invalidar();
+    limpiarRangos();
+    indiceNombres.limpiar();
+}
+
+
+void SistemaAdministrativo::compactarCadenas() {
+    if (cadenas.bytesLibres() == 0) return;
+    
+    ArenaCadenas nueva;
+    for (int i = 0; i < ranurasUsadas; i++) {
+        if (!ocupadas[i]) continue;
+        alumnos[i].nombre = nueva.guardar(alumnos[i].nombre);
+        alumnos[i].matricula = nueva.guardar(alumnos[i].matricula);
+    }
+    cadenas = std::move(nueva);
+}
+
+
+bool SistemaAdministrativo::aplicarCambio(const CambioBitacora& cambio) {
+    if (cambio.secuencia <= secuencia) return false;
+    
+    Bitacora* activa = bitacora;
+    bitacora = nullptr;
+    bool aplicado = false;
+    int posicion = buscarIndice(cambio.matricula);
+    
+    switch (cambio.tipo) {
+        case TipoCambio::ALTA:
+            if (posicion == -1) {
+                aplicado = insertarAlumno(Alumno(cambio.nombre, cambio.matricula, cambio.calificacion1,
+                                                 cambio.calificacion2, cambio.calificacion3));
+            }
+            break;
+        case TipoCambio::MODIFICACION:
+            if (posicion != -1 && (cambio.nuevaMatricula == cambio.matricula ||
+                                   buscarIndice(cambio.nuevaMatricula) == -1)) {
+                actualizarAlumno(posicion, Alumno(cambio.nombre, cambio.nuevaMatricula, cambio.calificacion1,
+                                                  cambio.calificacion2, cambio.calificacion3));
+                aplicado = true;
+            }
+            break;
+        case TipoCambio::BAJA:
+            if (posicion != -1) {
+                quitarAlumno(posicion);
+                aplicado = true;
+            }
+            break;
+    }
+    
+    bitacora = activa;
+    secuencia = cambio.secuencia;
+    return aplicado;
+}
@@ -0,0 +1,488 @@
+#ifndef SISTEMA_CORE_H
+#define SISTEMA_CORE_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <new>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "indice_matriculas.h"
+#include "lector_alumnos.h"
+#include "formato_binario.h"
+#include "bitacora.h"
+#include "columnas_calificaciones.h"
+#include "estadisticas_incrementales.h"
+#include "ranking_calificaciones.h"
+#include "indice_rangos.h"
+#include "distribucion_calificaciones.h"
+#include "busqueda_nombres.h"
+#include "arena_cadenas.h"
+#include "comandos_lote.h"
+#include "escritor_buffer.h"
+#include "formatos_reporte.h"
+#include "doble_instancia.h"
+#include "instrumentacion.h"
+
+
+const double CALIFICACION_MIN = 0.0;
+const double CALIFICACION_MAX = 100.0;
+const double CALIFICACION_APROBATORIA = 70.0;
+const int INTERVALOS_MAXIMOS_HISTOGRAMA = 100;
+
+
+// Dentro del sistema, nombre y matrícula apuntan a la arena de cadenas del
+// registro. Un Alumno construido fuera (para darlo de alta o modificar uno)
+// sólo toma prestadas las cadenas de quien lo crea; el sistema las copia a
+// su arena al incorporarlo.
+struct Alumno {
+    std::string_view nombre;
+    std::string_view matricula;
+    double calificacion1;
+    double calificacion2;
+    double calificacion3;
+    double calificacionFinal;
+    
+    
+    Alumno() : calificacion1(0), calificacion2(0), calificacion3(0), calificacionFinal(0) {}
+    
+    
+    Alumno(std::string_view nom, std::string_view mat, double c1, double c2, double c3) 
+        : nombre(nom), matricula(mat), calificacion1(c1), calificacion2(c2), calificacion3(c3) {
+        calcularCalificacionFinal();
+    }
+    
+    
+    void calcularCalificacionFinal() {
+        calificacionFinal = (calificacion1 + calificacion2 + calificacion3) / 3.0;
+        
+        calificacionFinal = std::round(calificacionFinal * 100.0) / 100.0;
+    }
+    
+    
+    bool estaAprobado() const {
+        return calificacionFinal >= CALIFICACION_APROBATORIA;
+    }
+    
+    
+    bool validarCalificaciones() const {
+        return (calificacion1 >= CALIFICACION_MIN && calificacion1 <= CALIFICACION_MAX &&
+                calificacion2 >= CALIFICACION_MIN && calificacion2 <= CALIFICACION_MAX &&
+                calificacion3 >= CALIFICACION_MIN && calificacion3 <= CALIFICACION_MAX);
+    }
+    
+    
+    bool validarDatos() const {
+        return !nombre.empty() && !matricula.empty() && validarCalificaciones();
+    }
+};
+
+
+// Cómo se elimina un alumno. LAPIDA deja la ranura vacía, conserva el orden
+// de los demás y la ranura se reutiliza en la siguiente alta. INTERCAMBIO
+// mueve el último alumno a la ranura eliminada. Ambos son O(1).
+enum class ModoBaja {
+    LAPIDA,
+    INTERCAMBIO
+};
+
+
+// Totales de un lote de comandos. `interrumpido` indica que el modo
+// estricto se detuvo en el primer error.
+struct ResultadoLote {
+    int comandos;
+    int cambios;
+    int errores;
+    bool interrumpido;
+};
+
+
+// Conteos de una fusión de calificaciones. `leido` es falso si no se pudo
+// abrir el archivo.
+struct ResultadoFusion {
+    int insertados;
+    int actualizados;
+    int sinCambios;
+    int rechazados;
+    bool leido;
+};
+
+
+// Copia de los datos de un alumno con cadenas propias; sigue siendo válida
+// después de modificar el registro.
+struct FichaAlumno {
+    std::string nombre;
+    std::string matricula;
+    double calificacion1;
+    double calificacion2;
+    double calificacion3;
+    double calificacionFinal;
+    
+    
+    bool estaAprobado() const {
+        return calificacionFinal >= CALIFICACION_APROBATORIA;
+    }
+};
+
+
+// Registro de alumnos sin interacción con la consola: las altas, bajas,
+// consultas y estadísticas reciben y devuelven datos, y los archivos se
+// indican por nombre. La interfaz de menús de sistema.cpp se construye
+// sobre esta API; los avisos de carga se escriben en la salida de errores.
+class SistemaAdministrativo {
+private:
+    Alumno* alumnos;
+    int cantidadAlumnos;
+    int ranurasUsadas;
+    int capacidad;
+    std::vector<unsigned char> ocupadas;
+    std::vector<int> ranurasLibres;
+    ModoBaja modoBaja;
+    IndiceMatriculas indiceMatriculas;
+    ColumnasCalificaciones columnas;
+    EstadisticasIncrementales estadisticas;
+    IndiceRanking ranking;
+    IndiceRangos rangos[COLUMNAS_RANGO];
+    DistribucionCalificaciones distribuciones[COLUMNAS_RANGO];
+    IndiceNombres indiceNombres;
+    ArenaCadenas cadenas;
+    Bitacora* bitacora;
+    uint64_t secuencia;
+    
+    // El arreglo se reserva sin construir alumnos: sólo las ranuras
+    // [0, ranurasUsadas) contienen objetos construidos.
+    static Alumno* reservarRanuras(int cantidad) {
+        return static_cast<Alumno*>(::operator new(sizeof(Alumno) * cantidad, std::nothrow));
+    }
+    
+    void liberarAlmacenamiento();
+    
+    // Copia los alumnos de otro sistema en un arreglo nuevo de la misma
+    // capacidad; los contadores ya deben estar copiados.
+    void copiarAlumnosDe(const SistemaAdministrativo& otro);
+    
+    // Crece moviendo los alumnos al arreglo nuevo, sin copiar sus cadenas.
+    void redimensionar(int nuevaCapacidad);
+    void vaciarRegistro();
+    
+    // Columna de cada índice de rangos y de cada distribución: 0 es la
+    // calificación final y 1 a 3 los parciales.
+    const double* columnaRango(int columna) const {
+        return columna == 0 ? columnas.finales() : columnas.parcial(columna);
+    }
+    
+    void indexarCalificaciones(int posicion);
+    void desindexarCalificaciones(int posicion);
+    void limpiarRangos();
+    void limpiarDistribuciones();
+    
+    bool hayRanuraDisponible() const {
+        return !ranurasLibres.empty() || ranurasUsadas < capacidad;
+    }
+    
+    bool asegurarRanura();
+    
+    // Coloca un alumno en una ranura libre o al final del arreglo; quien
+    // llama garantiza que haya ranura disponible y que la matrícula no exista.
+    // Recibe el alumno por valor y copia sus cadenas a la arena.
+    void anexarAlumno(Alumno alumno);
+    
+    // Deja libre una ranura ya vacía: si es la última se recorta el arreglo,
+    // si no pasa a la lista de ranuras libres.
+    void liberarRanura(int ranura);
+    
+    // Devuelve la cadena que debe quedar en el registro tras una
+    // modificación: la anterior si no cambió o una copia nueva en la arena.
+    std::string_view reemplazarCadena(std::string_view anterior, std::string_view nueva);
+    
+    // Las modificaciones y bajas dejan bytes sin uso en la arena; cuando
+    // superan a los vivos se copian las cadenas a una arena nueva.
+    void revisarCadenas();
+    void registrarCambio(CambioBitacora& cambio);
+    
+    // Altas, modificaciones y bajas pasan por estos tres métodos, que
+    // mantienen el índice y registran el cambio en la bitácora.
+    bool insertarAlumno(const Alumno& alumno);
+    void actualizarAlumno(int posicion, const Alumno& alumno);
+    void quitarAlumno(int posicion);
+    bool incorporarLinea(const LineaAlumno& linea, int numeroLinea, int& errores);
+    
+    // Analiza los bloques del archivo en paralelo y luego los incorpora en
+    // orden, de modo que duplicados y números de línea coinciden con la
+    // lectura secuencial.
+    int cargarEnParalelo(const ArchivoMapeado& archivo, int hilos, int& errores);
+    
+    // Convierte una calificación de un comando por lotes; devuelve el motivo
+    // del rechazo o nullptr si es válida.
+    static const char* leerCalificacionLote(std::string_view campo, double& calificacion);
+    
+    // Aplica un comando del modo por lotes y escribe su resultado en
+    // `salida`. Devuelve el motivo del rechazo, o nullptr si se aplicó;
+    // `cambio` indica si modificó el registro.
+    const char* ejecutarComando(const ComandoLote& comando, int numeroLinea, std::ostream& salida, bool& cambio);
+    
+public:
+    SistemaAdministrativo();
+    SistemaAdministrativo(const SistemaAdministrativo& otro);
+    
+    // El sistema movido queda vacío y sin bitácora; ésta pasa al nuevo.
+    SistemaAdministrativo(SistemaAdministrativo&& otro) noexcept;
+    SistemaAdministrativo& operator=(const SistemaAdministrativo& otro);
+    SistemaAdministrativo& operator=(SistemaAdministrativo&& otro) noexcept;
+    
+    ~SistemaAdministrativo() {
+        liberarAlmacenamiento();
+    }
+    
+    // Reserva ranuras para al menos `cantidad` alumnos; los cargadores la
+    // llaman cuando conocen el número de registros.
+    void reservar(int cantidad) {
+        redimensionar(cantidad);
+    }
+    
+    bool cargarDesdeArchivo(const std::string& nombreArchivo, int hilos = 1);
+    
+    // Aplica un archivo de actualizaciones en una sola pasada: cada línea se
+    // une al registro por matrícula con el índice hash. Las líneas
+    // matricula|c1|c2|c3 actualizan calificaciones; las de formato completo
+    // (nombre|matricula|c1|c2|c3) actualizan nombre y calificaciones o dan
+    // de alta al alumno si no existe. Sólo se recalculan los alumnos tocados.
+    ResultadoFusion fusionarCalificaciones(const std::string& nombreArchivo);
+    
+    // Los guardados escriben un archivo temporal, lo sincronizan y lo
+    // renombran sobre el destino, que nunca queda a medio escribir.
+    bool guardarEnArchivo(const std::string& nombreArchivo);
+    bool cargarBinario(const std::string& nombreArchivo);
+    bool guardarBinario(const std::string& nombreArchivo) const;
+    
+    // Contenido completo de alumnos.bin en memoria; es una copia inmutable
+    // del estado actual que puede escribirse desde otro hilo.
+    std::vector<char> instantaneaBinaria() const;
+    
+    // Posiciones, en orden del registro, de los alumnos cuyo nombre contiene
+    // `texto` (o tiene una palabra que empieza con él, con `prefijo`), sin
+    // distinguir mayúsculas ni acentos. El índice de nombres se construye en
+    // la primera búsqueda y después se mantiene con cada cambio.
+    std::vector<int> buscarPorNombre(std::string_view texto, bool prefijo);
+    
+    // Lectura en tiempo constante de las estadísticas mantenidas por las
+    // altas, bajas y modificaciones.
+    ResumenCalificaciones resumirFinales() const {
+        return estadisticas.resumen();
+    }
+    
+    static double promedioDe(const ResumenCalificaciones& resumen);
+    
+    // Desviación respecto al promedio ya redondeado, como el cálculo de dos
+    // pasadas original: Σ(x - μ)² = Σx² - 2μΣx + Nμ².
+    static double desviacionDe(const ResumenCalificaciones& resumen);
+    
+    double calcularPromedioGeneral() const {
+        return promedioDe(resumirFinales());
+    }
+    
+    double calcularDesviacionEstandar() const {
+        return desviacionDe(resumirFinales());
+    }
+    
+    // Posiciones de los alumnos con calificación entre `minimo` y `maximo`
+    // (inclusive) en `columna`: 0 es la final y 1 a 3 los parciales. Salen de
+    // menor a mayor calificación. El índice de la columna se construye en la
+    // primera consulta y después se mantiene con cada cambio, así que la
+    // consulta no recorre el registro: sólo los k alumnos del rango.
+    std::vector<int> alumnosEnRango(int columna, double minimo, double maximo);
+    
+    // Aprobados y reprobados por calificación final, en orden del registro.
+    std::vector<int> alumnosAprobados();
+    std::vector<int> alumnosReprobados();
+    
+    // Distribución de una columna (0 = final, 1 a 3 = parciales). Se cuenta
+    // en una pasada la primera vez que se pide y desde entonces se mantiene
+    // con cada cambio.
+    const DistribucionCalificaciones& distribucion(int columna);
+    
+    // Reporte general legible; requiere al menos un alumno. Con `hilos` > 1
+    // la sección de alumnos se divide en partes que se formatean en paralelo,
+    // cada una en su propio búfer, y se escriben en orden; en la misma pasada
+    // cada parte cuenta su distribución de finales y al final se suman.
+    void escribirReporteTexto(EscritorBuffer& archivo, int hilos) const;
+    
+    // Alumnos de las ranuras [desde, hasta) numerados desde `numero`.
+    void escribirAlumnosTexto(EscritorBuffer& archivo, int desde, int hasta, int numero) const;
+    void escribirReporteCsv(EscritorBuffer& archivo) const;
+    void escribirReporteJsonl(EscritorBuffer& archivo) const;
+    
+    // Una pasada por columna; las calificaciones se leen de las columnas ya
+    // mantenidas y cada valor va directo al búfer del escritor.
+    void escribirReporteColumnar(EscritorBuffer& archivo) const;
+    bool escribirReporte(const std::string& nombreArchivo, FormatoReporte formato, int hilos = 1) const;
+    
+    bool escribirReporteGeneral(const std::string& nombreArchivo, int hilos = 1) const {
+        return escribirReporte(nombreArchivo, FormatoReporte::TEXTO, hilos);
+    }
+    
+    // Posiciones de los k alumnos con mejor (o peor) calificación final, sin
+    // copiar registros. Con el índice de ranking activo se leen de él; si no,
+    // se seleccionan con un montículo acotado sobre la columna de finales.
+    std::vector<int> extremosCalificacion(size_t k, bool mejores);
+    
+    // Alta sin interacción; devuelve false si los datos no son válidos, la
+    // matrícula ya existe o no hay memoria.
+    bool insertar(const Alumno& alumno);
+    
+    // Reemplaza los datos del alumno con `matricula`; devuelve false si no
+    // existe, los datos no son válidos o la nueva matrícula es de otro.
+    bool actualizar(std::string_view matricula, const Alumno& alumno);
+    bool buscar(std::string_view matricula, FichaAlumno& ficha) const;
+    
+    // Posición del alumno con `matricula`, o -1 si no existe; como buscar
+    // pero sin copiar sus datos.
+    int buscarIndice(std::string_view matricula) const;
+    
+    // Datos del alumno en una posición devuelta por las consultas (por
+    // nombre, por rango o mejores y peores), válida hasta el siguiente cambio.
+    FichaAlumno fichaDe(int posicion) const;
+    
+    // Calificación de `columna` (0 = final, 1 a 3 = parciales) del alumno en
+    // `posicion`.
+    double calificacionEn(int posicion, int columna) const {
+        return columnaRango(columna)[posicion];
+    }
+    
+    // Como extremosCalificacion pero sin modificar el sistema: usa el índice
+    // de ranking sólo si está al día.
+    std::vector<FichaAlumno> fichasExtremas(size_t k, bool mejores) const;
+    
+    // Baja sin interacción; devuelve false si la matrícula no existe.
+    bool eliminarPorMatricula(std::string_view matricula);
+    
+    // Ejecuta un comando por línea (ver comandos_lote.h) y escribe una línea
+    // de resultado por comando: "ok|línea|comando|..." o
+    // "error|línea|comando|motivo". No guarda nada; quien llama decide si
+    // conserva los cambios. En modo estricto se detiene en el primer error.
+    ResultadoLote ejecutarLote(std::istream& entrada, std::ostream& salida, bool estricto);
+    
+    // Quita las ranuras vacías dejadas por las bajas, conservando el orden
+    // de los alumnos. Se hace al guardar la instantánea y cuando las
+    // ranuras libres superan la mitad del arreglo.
+    void compactarRegistro();
+    
+    // Copia las cadenas vivas a una arena nueva y descarta la anterior, con
+    // los bytes que dejaron las modificaciones y bajas.
+    void compactarCadenas();
+    
+    // Bytes pedidos por la arena de cadenas y bytes de cadenas en uso.
+    size_t bytesCadenasReservados() const {
+        return cadenas.bytesReservados();
+    }
+    
+    size_t bytesCadenasVivos() const {
+        return cadenas.bytesVivos();
+    }
+    
+    void asignarModoBaja(ModoBaja modo) {
+        modoBaja = modo;
+    }
+    
+    // Mantiene un índice ordenado por calificación final para que las
+    // consultas de mejores y peores no recorran el registro.
+    void mantenerRanking(bool activo) {
+        ranking.activar(activo);
+    }
+    
+    int getCantidadAlumnos() const {
+        return cantidadAlumnos;
+    }
+    
+    uint64_t getSecuencia() const {
+        return secuencia;
+    }
+    
+    void asignarBitacora(Bitacora* nuevaBitacora) {
+        bitacora = nuevaBitacora;
+    }
+    
+    // Reaplica un cambio leído de la bitácora sin volver a registrarlo. Los
+    // cambios ya incluidos en la instantánea cargada se ignoran.
+    bool aplicarCambio(const CambioBitacora& cambio);
+};
+
+
+// Acceso al sistema desde varios hilos: muchas consultas a la vez y una
+// modificación a la vez, sin que las consultas esperen nunca a las
+// modificaciones (ver doble_instancia.h). Si el sistema tiene bitácora la
+// conserva sólo una de las dos copias, así que cada cambio se registra una
+// vez. Las consultas devuelven copias, nunca referencias al registro.
+class SistemaConcurrente {
+private:
+    DobleInstancia<SistemaAdministrativo> sistemas;
+    
+public:
+    explicit SistemaConcurrente(SistemaAdministrativo&& sistema) : sistemas(std::move(sistema)) {}
+    
+    
+    bool buscar(std::string_view matricula, FichaAlumno& ficha) const {
+        return sistemas.leer([&](const SistemaAdministrativo& sistema) { 
+            return sistema.buscar(matricula, ficha); 
+        });
+    }
+    
+    
+    std::vector<FichaAlumno> extremos(size_t k, bool mejores) const {
+        return sistemas.leer([&](const SistemaAdministrativo& sistema) { 
+            return sistema.fichasExtremas(k, mejores); 
+        });
+    }
+    
+    
+    ResumenCalificaciones resumen() const {
+        return sistemas.leer([](const SistemaAdministrativo& sistema) { return sistema.resumirFinales(); });
+    }
+    
+    
+    int getCantidadAlumnos() const {
+        return sistemas.leer([](const SistemaAdministrativo& sistema) { return sistema.getCantidadAlumnos(); });
+    }
+    
+    
+    bool escribirReporte(const std::string& nombreArchivo, FormatoReporte formato) const {
+        return sistemas.leer([&](const SistemaAdministrativo& sistema) { 
+            return sistema.escribirReporte(nombreArchivo, formato); 
+        });
+    }
+    
+    
+    bool insertar(const Alumno& alumno) {
+        return sistemas.escribir([&](SistemaAdministrativo& sistema) { return sistema.insertar(alumno); });
+    }
+    
+    
+    bool actualizar(std::string_view matricula, const Alumno& alumno) {
+        return sistemas.escribir([&](SistemaAdministrativo& sistema) { 
+            return sistema.actualizar(matricula, alumno); 
+        });
+    }
+    
+    
+    bool eliminar(std::string_view matricula) {
+        return sistemas.escribir([&](SistemaAdministrativo& sistema) { 
+            return sistema.eliminarPorMatricula(matricula); 
+        });
+    }
+    
+    
+    // Aplica varias modificaciones como una sola, para pagar una vez la
+    // espera a los lectores. `cambio` recibe el sistema y se ejecuta dos
+    // veces, así que debe tener el mismo efecto en ambas copias.
+    template <typename F>
+    void modificar(F&& cambio) {
+        sistemas.escribir([&](SistemaAdministrativo& sistema) { cambio(sistema); });
+    }
+};
+
+#endif